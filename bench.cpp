@@ -0,0 +1,333 @@
+// minicode benchmarks: throughput of encode, decode, convert and stream
+// over the corpora of bench_gen.py, with glibc iconv as a baseline.
+//
+//   bench [-t SECONDS] [-o OUTPUT] CORPUS...
+//
+// a corpus is utf-8 text in a file named corpus_NAME.txt, corpus_short.txt
+// is taken line by line, one call per line. the results go to OUTPUT as
+// tab separated lines, one per measurement, and as a table to stdout.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "minicode.h"
+#include "minicode_cjk.h"
+
+#if defined(__GLIBC__) && !defined(BENCH_NO_ICONV)
+#include <iconv.h>
+#define BENCH_ICONV 1
+#endif
+
+using namespace std;
+using minicode::bytes;
+using minicode::bytes_view;
+using minicode::str;
+using minicode::str_view;
+
+template<typename T> struct codec_name;
+
+#define CODEC_NAME(T, NAME, ICONV) \
+  template<> struct codec_name<minicode::T> { \
+    static const char* name() { return NAME; } \
+    static const char* iconv() { return ICONV; } \
+  };
+
+CODEC_NAME(utf8, "utf-8", "UTF-8")
+CODEC_NAME(utf16le, "utf-16le", "UTF-16LE")
+CODEC_NAME(utf16be, "utf-16be", "UTF-16BE")
+CODEC_NAME(utf32le, "utf-32le", "UTF-32LE")
+CODEC_NAME(utf32be, "utf-32be", "UTF-32BE")
+CODEC_NAME(latin1, "iso-8859-1", "ISO-8859-1")
+CODEC_NAME(cp1252, "windows-1252", "CP1252")
+CODEC_NAME(gb18030, "gb18030", "GB18030")
+CODEC_NAME(gbk, "gbk", "GBK")
+CODEC_NAME(shift_jis, "shift_jis", "SHIFT_JIS")
+CODEC_NAME(euc_kr, "euc-kr", "EUC-KR")
+
+struct result {
+  string corpus;
+  string op;
+  string from;
+  string to;
+  string impl;
+  size_t bytes;
+  size_t chars;
+  double sec;
+};
+
+struct corpus {
+  string name;
+  str text;
+  // code point ranges of the lines, when it is taken line by line
+  vector<pair<int, int>> lines;
+};
+
+static double min_time = 0.2;
+static vector<result> results;
+
+// best time of one call of f, repeated for at least min_time and 3 times
+template<typename F>
+static double measure(F f) {
+  double best = 1e30;
+  double total = 0;
+  for (int n = 0; n < 3 || total < min_time; ++n) {
+    auto t0 = chrono::steady_clock::now();
+    f();
+    double s = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+    best = min(best, s);
+    total += s;
+  }
+  return best;
+}
+
+static void report(const corpus& c, const char* op, const char* from, const char* to, const char* impl,
+                   size_t bytes, double sec) {
+  result r = {c.name, op, from, to, impl, bytes, c.text.size(), sec};
+  results.push_back(r);
+  printf("%-9s %-7s %-13s %-13s %-9s %8.3f GB/s %9.1f Mchar/s\n", c.name.c_str(), op, from, to, impl,
+         bytes / sec / 1e9, c.text.size() / sec / 1e6);
+  fflush(stdout);
+}
+
+// the text of a corpus in T, one piece per line or one for all
+template<typename T>
+static bool encode_pieces(const corpus& c, vector<bytes>& out) {
+  out.clear();
+  if (c.lines.empty()) {
+    out.resize(1);
+    return minicode::encode<T>(c.text, out[0]) == 0;
+  }
+  out.resize(c.lines.size());
+  for (size_t i = 0; i < c.lines.size(); ++i) {
+    if (minicode::encode<T>(str_view(c.text).subrange(c.lines[i].first, c.lines[i].second), out[i]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static size_t total_size(const vector<bytes>& bs) {
+  size_t n = 0;
+  for (const bytes& b : bs) {
+    n += b.size();
+  }
+  return n;
+}
+
+template<typename T>
+static void bench_codec(const corpus& c) {
+  vector<bytes> enc;
+  if (!encode_pieces<T>(c, enc)) {
+    return;
+  }
+  const char *name = codec_name<T>::name();
+  size_t n = total_size(enc);
+  bytes b;
+  str s;
+  if (c.lines.empty()) {
+    report(c, "encode", "unicode", name, "minicode", n, measure([&] { minicode::encode<T>(c.text, b); }));
+    report(c, "decode", name, "unicode", "minicode", n, measure([&] { minicode::decode<T>(enc[0], s); }));
+    // fed in 64 KiB chunks, as from a socket
+    report(c, "stream", name, "unicode", "minicode", n, measure([&] {
+      minicode::stream<T> st;
+      s.clear();
+      for (size_t i = 0; i < n; i += 1 << 16) {
+        st.add_bytes(enc[0].data() + i, (std::uint32_t)min<size_t>(1 << 16, n - i));
+        st.read_into(s);
+      }
+    }));
+  } else {
+    report(c, "encode", "unicode", name, "minicode", n, measure([&] {
+      for (const pair<int, int>& l : c.lines) {
+        minicode::encode<T>(str_view(c.text).subrange(l.first, l.second), b);
+      }
+    }));
+    report(c, "decode", name, "unicode", "minicode", n, measure([&] {
+      for (const bytes& e : enc) {
+        minicode::decode<T>(e, s);
+      }
+    }));
+  }
+}
+
+#if defined(BENCH_ICONV)
+// the same conversion through iconv, if it knows both and gives the same bytes
+static void bench_iconv(const corpus& c, const char* from, const char* to, const char* name1, const char* name2,
+                        const vector<bytes>& in, const vector<bytes>& expected) {
+  iconv_t cd = iconv_open(to, from);
+  if (cd == (iconv_t)-1) {
+    return;
+  }
+  size_t cap = 0;
+  for (const bytes& e : expected) {
+    cap = max(cap, e.size());
+  }
+  vector<char> out(cap + 16);
+  bool same = true;
+  auto run = [&](bool check) {
+    for (size_t i = 0; i < in.size(); ++i) {
+      char *ib = const_cast<char*>(in[i].data());
+      size_t il = in[i].size();
+      char *ob = out.data();
+      size_t ol = out.size();
+      iconv(cd, nullptr, nullptr, nullptr, nullptr);
+      if (iconv(cd, &ib, &il, &ob, &ol) == (size_t)-1 ||
+          (check && bytes(out.data(), ob - out.data()) != expected[i])) {
+        same = false;
+      }
+    }
+  };
+  run(true);
+  if (same) {
+    report(c, "convert", name1, name2, "iconv", total_size(in), measure([&] { run(false); }));
+  }
+  iconv_close(cd);
+}
+#endif
+
+template<typename T1, typename T2>
+static void bench_pair(const corpus& c) {
+  vector<bytes> in, expected;
+  if (!encode_pieces<T1>(c, in) || !encode_pieces<T2>(c, expected)) {
+    return;
+  }
+  const char *name1 = codec_name<T1>::name();
+  const char *name2 = codec_name<T2>::name();
+  bytes b;
+  report(c, "convert", name1, name2, "minicode", total_size(in), measure([&] {
+    for (const bytes& e : in) {
+      minicode::convert<T1, T2>(e, b);
+    }
+  }));
+  if (!c.lines.empty()) {
+    // the same lines as one column
+    string values;
+    vector<int32_t> offsets(1, 0);
+    for (const bytes& e : in) {
+      values.append(e.data(), e.size());
+      offsets.push_back((int32_t)values.size());
+    }
+    minicode::column out;
+    report(c, "column", name1, name2, "minicode", values.size(), measure([&] {
+      minicode::convert_column<T1, T2>(values, offsets, out);
+    }));
+  }
+#if defined(BENCH_ICONV)
+  bench_iconv(c, codec_name<T1>::iconv(), codec_name<T2>::iconv(), name1, name2, in, expected);
+#endif
+}
+
+template<typename... Ts>
+struct codec_list {};
+
+template<typename... Ts>
+static void bench_codecs(const corpus& c, codec_list<Ts...>) {
+  int run[] = {0, (bench_codec<Ts>(c), 0)...};
+  (void)run;
+}
+
+template<typename T1, typename... Ts>
+static void bench_pairs_from(const corpus& c, codec_list<Ts...>) {
+  int run[] = {0, (bench_pair<T1, Ts>(c), 0)...};
+  (void)run;
+}
+
+template<typename... Ts>
+static void bench_pairs(const corpus& c, codec_list<Ts...> l) {
+  int run[] = {0, (bench_pairs_from<Ts>(c, l), 0)...};
+  (void)run;
+}
+
+typedef codec_list<minicode::utf8, minicode::utf16le, minicode::utf16be, minicode::utf32le, minicode::utf32be> utfs;
+typedef codec_list<minicode::latin1, minicode::cp1252, minicode::gb18030, minicode::gbk,
+                   minicode::shift_jis, minicode::euc_kr> legacy;
+
+template<typename... Ts>
+static void bench_legacy(const corpus& c, codec_list<Ts...>) {
+  int run[] = {0, (bench_pair<minicode::utf8, Ts>(c), bench_pair<Ts, minicode::utf8>(c),
+                   bench_pair<Ts, minicode::utf16le>(c), 0)...};
+  (void)run;
+}
+
+static bool read_corpus(const char* path, corpus& c) {
+  ifstream f(path, ios::binary);
+  if (!f) {
+    return false;
+  }
+  string data((istreambuf_iterator<char>(f)), istreambuf_iterator<char>());
+  if (minicode::decode<minicode::utf8>(bytes_view(data), c.text) != 0) {
+    return false;
+  }
+  string base = path;
+  base = base.substr(base.find_last_of('/') + 1);
+  if (base.compare(0, 7, "corpus_") == 0) {
+    base = base.substr(7);
+  }
+  c.name = base.substr(0, base.rfind('.'));
+  if (c.name == "short") {
+    int start = 0;
+    for (int i = 0; i < (int)c.text.size(); ++i) {
+      if (c.text[i] == minicode::uchar('\n')) {
+        c.lines.push_back(make_pair(start, i + 1));
+        start = i + 1;
+      }
+    }
+  }
+  return true;
+}
+
+static int usage() {
+  fprintf(stderr, "usage: bench [-t SECONDS] [-o OUTPUT] CORPUS...\n");
+  return 2;
+}
+
+int main(int argc, char* argv[]) {
+  const char *output = nullptr;
+  vector<const char*> paths;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      min_time = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      output = argv[++i];
+    } else if (argv[i][0] != '-') {
+      paths.push_back(argv[i]);
+    } else {
+      return usage();
+    }
+  }
+  if (paths.empty()) {
+    return usage();
+  }
+  printf("minicode %s kernels\n", minicode::simd_level());
+  for (const char* p : paths) {
+    corpus c;
+    if (!read_corpus(p, c)) {
+      fprintf(stderr, "bench: can not read %s as utf-8\n", p);
+      return 2;
+    }
+    bench_codecs(c, utfs());
+    bench_codecs(c, legacy());
+    bench_pairs(c, utfs());
+    bench_legacy(c, legacy());
+  }
+  if (output != nullptr) {
+    FILE *f = fopen(output, "w");
+    if (f == nullptr) {
+      fprintf(stderr, "bench: can not open %s\n", output);
+      return 2;
+    }
+    fprintf(f, "# kernels\t%s\n", minicode::simd_level());
+    fprintf(f, "corpus\top\tfrom\tto\timpl\tbytes\tchars\tseconds\tgb_per_s\tmchars_per_s\n");
+    for (const result& r : results) {
+      fprintf(f, "%s\t%s\t%s\t%s\t%s\t%zu\t%zu\t%.6f\t%.4f\t%.2f\n", r.corpus.c_str(), r.op.c_str(),
+              r.from.c_str(), r.to.c_str(), r.impl.c_str(), r.bytes, r.chars, r.sec,
+              r.bytes / r.sec / 1e9, r.chars / r.sec / 1e6);
+    }
+    fclose(f);
+  }
+  return 0;
+}
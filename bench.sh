@@ -0,0 +1,22 @@
+#!/usr/bin/env bash
+
+# MB of text per corpus, seconds per measurement
+SIZE=${1:-4}
+TIME=${2:-0.2}
+
+echo "compiling the bench.cpp ..."
+g++ -Wall -Wextra -O2 ${CXXFLAGS:--march=native} -std=c++11 -pthread bench.cpp -o bench
+
+echo ""
+echo "generate corpora ..."
+./bench_gen.py $SIZE
+
+echo ""
+echo "run bench ..."
+echo ""
+./bench -t $TIME -o bench_output.txt corpus_*.txt
+
+echo ""
+echo "results in bench_output.txt"
+echo "clean ..."
+rm bench corpus_*.txt
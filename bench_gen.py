@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+
+# generate the utf-8 corpora of bench.cpp, the same ones for the same arguments.
+#
+#   bench_gen.py [MB per corpus] [seed]
+
+import sys
+import random
+
+ENGLISH = ("the of and to in is that for it as was with be by on not he this are or his from at which "
+           "but have an they you were her she there been one all we their has would when if so no will "
+           "more can out up into do time only about other new some could these two may first then any "
+           "people like over such our what year most also after know because good just those well work "
+           "system data value string buffer encoding character server request response number").split()
+
+LATIN = ("été élève déjà très où français garçon noël über grüße straße schön müde mädchen año niño "
+         "señor canción corazón acción mañana está então não coração pão ação naïve café crème à "
+         "la le de et en un une die der und das ist el los las por para con que il est dans").split()
+
+def hanzi():
+    # level 1 of gb2312, the 3755 most frequent characters
+    cs = []
+    for l in range(0xb0, 0xd8):
+        for t in range(0xa1, 0xff):
+            try:
+                cs.append(bytes([l, t]).decode('gb2312'))
+            except UnicodeDecodeError:
+                pass
+    return cs
+
+def kana():
+    return [chr(u) for u in list(range(0x3041, 0x3094)) + list(range(0x30a1, 0x30f7))]
+
+def kanji():
+    cs = []
+    for l in range(0x88, 0x98):
+        for t in range(0x40, 0xfd):
+            try:
+                cs.append(bytes([l, t]).decode('shift_jis'))
+            except UnicodeDecodeError:
+                pass
+    return cs
+
+def hangul():
+    cs = []
+    for l in range(0xb0, 0xc9):
+        for t in range(0xa1, 0xff):
+            try:
+                cs.append(bytes([l, t]).decode('euc_kr'))
+            except UnicodeDecodeError:
+                pass
+    return cs
+
+EMOJI = ([chr(u) for u in range(0x1f600, 0x1f650)] + [chr(u) for u in range(0x1f300, 0x1f3a0)] +
+         ['❤️', '\U0001f44d\U0001f3fd', '\U0001f468‍\U0001f469‍\U0001f467',
+          '\U0001f1e8\U0001f1f3', '\U0001f1ef\U0001f1f5', '✅', '✨'])
+
+def words(ws, n):
+    return ' '.join(random.choice(ws) for _ in range(n))
+
+def sentence_en():
+    s = words(ENGLISH, random.randint(5, 18))
+    return s[0].upper() + s[1:] + random.choice(['.', '.', '.', '?', '!', ','])
+
+def sentence_latin():
+    s = words(ENGLISH[:40] + LATIN * 2, random.randint(5, 16))
+    return s[0].upper() + s[1:] + '.'
+
+def sentence_cjk(cs, punct):
+    s = ''.join(random.choice(cs) for _ in range(random.randint(6, 30)))
+    return s + random.choice(punct)
+
+def sentence_ja(ks, kj):
+    s = ''.join(random.choice(kj) if random.random() < 0.35 else random.choice(ks)
+                for _ in range(random.randint(8, 30)))
+    return s + random.choice('。、')
+
+def sentence_ko(hs):
+    return ' '.join(''.join(random.choice(hs) for _ in range(random.randint(1, 5)))
+                    for _ in range(random.randint(3, 10))) + '.'
+
+def sentence_emoji():
+    out = []
+    for _ in range(random.randint(3, 10)):
+        out.append(random.choice(ENGLISH) if random.random() < 0.5 else
+                   ''.join(random.choice(EMOJI) for _ in range(random.randint(1, 3))))
+    return ' '.join(out)
+
+def sentence_mixed(cs):
+    # word-length ascii runs, every fifth one cjk
+    return ' '.join(''.join(random.choice(cs) for _ in range(random.randint(1, 4))) if i % 5 == 4 else
+                    random.choice(ENGLISH) for i in range(random.randint(5, 18))) + '.'
+
+def paragraph(make, size):
+    out = []
+    n = 0
+    while n < size:
+        p = ' '.join(make() for _ in range(random.randint(2, 8))) + '\n'
+        out.append(p)
+        n += len(p)
+    return ''.join(out)
+
+def web_page(size, hz):
+    out = ['<!DOCTYPE html>\n<html lang="en">\n<head>\n<meta charset="utf-8">\n<title>',
+           sentence_en(), '</title>\n<style>body { margin: 0 auto; max-width: 60em; }</style>\n</head>\n<body>\n']
+    n = 0
+    i = 0
+    while n < size:
+        i += 1
+        r = random.random()
+        if r < 0.5:
+            text = sentence_en()
+        elif r < 0.75:
+            text = sentence_cjk(hz, '，。')
+        elif r < 0.9:
+            text = sentence_latin()
+        else:
+            text = sentence_emoji()
+        block = ('<div class="item" id="item-%d">\n  <a href="https://example.com/p/%d?ref=list&amp;page=%d">'
+                 '%s</a>\n  <p>%s</p>\n</div>\n' % (i, random.randint(1, 99999), i % 17, text[:20], text))
+        if i % 50 == 0:
+            block += '<script>window.track && window.track({"id": %d, "ok": true});</script>\n' % i
+        out.append(block)
+        n += len(block)
+    out.append('</body>\n</html>\n')
+    return ''.join(out)
+
+def short_strings(size, hz, ks, kj, hs):
+    makes = [sentence_en, sentence_latin, sentence_emoji,
+             lambda: sentence_cjk(hz, '，。'), lambda: sentence_ja(ks, kj), lambda: sentence_ko(hs)]
+    out = []
+    n = 0
+    while n < size:
+        s = random.choice(makes)()[:random.randint(1, 40)].strip('\n') + '\n'
+        out.append(s)
+        n += len(s)
+    return ''.join(out)
+
+def main(script, mb='4', seed='1', *argv):
+    size = int(float(mb) * (1 << 20))
+    random.seed(int(seed))
+    hz, ks, kj, hs = hanzi(), kana(), kanji(), hangul()
+    # sizes are in code points, roughly what the utf-8 files weigh
+    corpora = [
+        ('ascii', paragraph(sentence_en, size)),
+        ('latin', paragraph(sentence_latin, size)),
+        ('cjk', paragraph(lambda: sentence_cjk(hz, '，。'), size // 3)),
+        ('japanese', paragraph(lambda: sentence_ja(ks, kj), size // 3)),
+        ('korean', paragraph(lambda: sentence_ko(hs), size // 2)),
+        ('emoji', paragraph(sentence_emoji, size // 2)),
+        ('mixed', paragraph(lambda: sentence_mixed(hz), size // 2)),
+        ('web', web_page(size, hz)),
+        ('short', short_strings(size // 2, hz, ks, kj, hs)),
+    ]
+    for name, text in corpora:
+        with open('corpus_%s.txt' % name, 'wb') as f:
+            f.write(text.encode('utf-8'))
+
+if __name__ == '__main__':
+    main(*sys.argv)
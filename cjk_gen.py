@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+
+# generate minicode_cjk_tables.h from the Python codecs
+
+import sys
+
+def trails(lo, hi, skip):
+    return [t for t in range(lo, hi + 1) if t not in skip]
+
+def cells(codec, leads, ts):
+    rows = [-1] * 256
+    data = []
+    for l in leads:
+        row = []
+        for t in ts:
+            try:
+                u = bytes([l, t]).decode(codec)
+                row.append(ord(u) if len(u) == 1 else 0)
+            except UnicodeDecodeError:
+                row.append(0)
+        if any(row):
+            rows[l] = len(data) // len(ts)
+            data.extend(row)
+    return rows, data
+
+def gb18030_index(b):
+    return (((b[0] - 0x81) * 10 + (b[1] - 0x30)) * 126 + (b[2] - 0x81)) * 10 + (b[3] - 0x30)
+
+def gb18030_ranges():
+    # bmp code points without a two byte code, consecutive four byte indices
+    index, code = [], []
+    prev = None
+    for u in range(0x80, 0x10000):
+        if 0xd800 <= u <= 0xdfff:
+            continue
+        e = chr(u).encode('gb18030')
+        if len(e) != 4:
+            continue
+        i = gb18030_index(e)
+        if prev is None or i != prev[0] + 1 or u != prev[1] + 1:
+            index.append(i)
+            code.append(u)
+        prev = (i, u)
+    index.append(prev[0] + 1)
+    code.append(prev[1] + 1)
+    return index, code
+
+def array(out, ctype, name, comment, values, per_line=12):
+    fmt = str if ctype.startswith('std::int') else '0x{:x}'.format
+    out.append('// %s' % comment)
+    out.append('inline const %s* %s() {' % (ctype, name))
+    out.append('  static const %s t[%d] = {' % (ctype, len(values)))
+    for i in range(0, len(values), per_line):
+        out.append('    ' + ', '.join(fmt(v) for v in values[i:i + per_line]) + ',')
+    out.append('  };')
+    out.append('  return t;')
+    out.append('}')
+    out.append('')
+
+def main(script, name='minicode_cjk_tables.h', *argv):
+    out = ['// generated by cjk_gen.py from the Python codecs, do not edit',
+           '',
+           '#ifndef _MINICODE_CJK_TABLES_H_',
+           '#define _MINICODE_CJK_TABLES_H_ 1',
+           '',
+           '#include <cstdint>',
+           '',
+           'namespace minicode {',
+           'namespace detail {',
+           'namespace cjk {',
+           '']
+
+    gb_trails = trails(0x40, 0xfe, [0x7f])
+    rows, data = cells('gb18030', range(0x81, 0xff), gb_trails)
+    array(out, 'std::int16_t', 'gb18030_rows', 'row of each lead byte, -1 if it is not one', rows, 16)
+    array(out, 'std::uint16_t', 'gb18030_cells',
+          'two byte codes, trail 0x40-0xfe without 0x7f, 0 where unmapped', data)
+    # gbk is the same table without some cells
+    bits = [0] * ((len(data) + 31) // 32)
+    for i, u in enumerate(data):
+        if u == 0:
+            continue
+        l = 0x81 + i // len(gb_trails)
+        t = gb_trails[i % len(gb_trails)]
+        try:
+            if ord(bytes([l, t]).decode('gbk')) == u:
+                bits[i // 32] |= 1 << (i % 32)
+        except UnicodeDecodeError:
+            pass
+    array(out, 'std::uint32_t', 'gbk_bits', 'gb18030 cells that gbk has too', bits, 8)
+    index, code = gb18030_ranges()
+    out.append('const int gb18030_range_count = %d;' % (len(index) - 1))
+    out.append('')
+    array(out, 'std::uint32_t', 'gb18030_range_index',
+          'four byte bmp ranges, first index of each and an end mark', index, 10)
+    array(out, 'std::uint32_t', 'gb18030_range_code', 'first code point of each range', code, 10)
+
+    rows, data = cells('shift_jis', list(range(0x81, 0xa0)) + list(range(0xe0, 0xfd)),
+                       trails(0x40, 0xfc, [0x7f]))
+    array(out, 'std::int16_t', 'shift_jis_rows', 'row of each lead byte, -1 if it is not one', rows, 16)
+    array(out, 'std::uint16_t', 'shift_jis_cells',
+          'two byte codes, trail 0x40-0xfc without 0x7f, 0 where unmapped', data)
+
+    rows, data = cells('euc_kr', range(0xa1, 0xff), trails(0xa1, 0xfe, []))
+    array(out, 'std::int16_t', 'euc_kr_rows', 'row of each lead byte, -1 if it is not one', rows, 16)
+    array(out, 'std::uint16_t', 'euc_kr_cells', 'two byte codes, trail 0xa1-0xfe, 0 where unmapped', data)
+
+    out += ['} // namespace cjk',
+            '} // namespace detail',
+            '} // namespace minicode',
+            '',
+            '#endif // _MINICODE_CJK_TABLES_H_']
+    with open(name, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+if __name__ == '__main__':
+    main(*sys.argv)
@@ -0,0 +1,243 @@
+// minicode-conv: convert text from one encoding to another, like iconv.
+//
+//   minicode-conv -f FROM -t TO [-o OUTPUT] [-v] [INPUT]
+//
+// reading, converting and writing run on their own threads,
+// connected by bounded queues, so i/o and compute overlap.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+#include "minicode.h"
+#include "minicode_cjk.h"
+
+using namespace std;
+
+static const size_t block_size = 1 << 20;
+static const size_t queue_size = 4;
+
+struct block {
+  vector<char> owned;
+  minicode::bytes_view data;
+};
+
+// fixed capacity queue, pop returns false once it is closed and drained
+class block_queue {
+public:
+  void push(block&& b) {
+    unique_lock<mutex> lock(_mutex);
+    _not_full.wait(lock, [this] { return _blocks.size() < queue_size; });
+    _blocks.push_back(std::move(b));
+    _not_empty.notify_one();
+  }
+
+  bool pop(block& b) {
+    unique_lock<mutex> lock(_mutex);
+    _not_empty.wait(lock, [this] { return !_blocks.empty() || _closed; });
+    if (_blocks.empty()) {
+      return false;
+    }
+    b = std::move(_blocks.front());
+    _blocks.pop_front();
+    _not_full.notify_one();
+    return true;
+  }
+
+  void close() {
+    lock_guard<mutex> lock(_mutex);
+    _closed = true;
+    _not_empty.notify_all();
+  }
+
+private:
+  mutex _mutex;
+  condition_variable _not_empty;
+  condition_variable _not_full;
+  deque<block> _blocks;
+  bool _closed = false;
+};
+
+struct options {
+  string from;
+  string to;
+  const char* input = nullptr;
+  const char* output = nullptr;
+  bool verbose = false;
+};
+
+// a regular file is mapped and handed out in slices,
+// anything else (stdin, pipes and fifos, also given by path) is read into owned blocks.
+static bool read_input(const minicode::mapped_file* mf, FILE* in, block_queue& q, size_t& total) {
+  if (mf != nullptr) {
+    minicode::bytes_view bs = mf->data();
+    for (size_t i = 0; i < bs.size(); i += block_size) {
+      block b;
+      b.data = minicode::bytes_view(bs.data() + i, min(bs.size() - i, block_size));
+      // fault the pages in here rather than on the converting thread
+      volatile char sink = 0;
+      for (size_t j = 0; j < b.data.size(); j += 4096) {
+        sink ^= b.data.data()[j];
+      }
+      (void)sink;
+      total += b.data.size();
+      q.push(std::move(b));
+    }
+    q.close();
+    return true;
+  }
+  while (true) {
+    block b;
+    b.owned.resize(block_size);
+    size_t n = fread(b.owned.data(), 1, block_size, in);
+    if (n == 0) {
+      break;
+    }
+    b.owned.resize(n);
+    b.data = minicode::bytes_view(b.owned.data(), n);
+    total += n;
+    q.push(std::move(b));
+  }
+  q.close();
+  return ferror(in) == 0;
+}
+
+static bool write_output(FILE* f, block_queue& q, size_t& total) {
+  block b;
+  bool ok = true;
+  while (q.pop(b)) {
+    ok = ok && fwrite(b.owned.data(), 1, b.owned.size(), f) == b.owned.size();
+    total += b.owned.size();
+  }
+  return ok;
+}
+
+static int run(const minicode::codec& from, const minicode::codec& to, const options& opt) {
+  unique_ptr<minicode::mapped_file> mf;
+  FILE *in = stdin;
+  if (opt.input != nullptr) {
+    struct stat st;
+    bool opened;
+    if (stat(opt.input, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+      mf.reset(new minicode::mapped_file(opt.input));
+      opened = mf->good();
+    } else {
+      in = fopen(opt.input, "rb");
+      opened = in != nullptr;
+    }
+    if (!opened) {
+      fprintf(stderr, "minicode-conv: can not open %s\n", opt.input);
+      return 2;
+    }
+  }
+  FILE *out = stdout;
+  if (opt.output != nullptr && (out = fopen(opt.output, "wb")) == nullptr) {
+    fprintf(stderr, "minicode-conv: can not open %s\n", opt.output);
+    if (in != stdin) {
+      fclose(in);
+    }
+    return 2;
+  }
+  auto t0 = chrono::steady_clock::now();
+  block_queue in_q, out_q;
+  size_t in_bytes = 0, out_bytes = 0;
+  bool read_ok = true, write_ok = true;
+  thread reader([&] { read_ok = read_input(mf.get(), in, in_q, in_bytes); });
+  thread writer([&] { write_ok = write_output(out, out_q, out_bytes); });
+
+  minicode::codec_transcoder tc(from, to, [&out_q](const char* b, size_t n) {
+    block o;
+    o.owned.assign(b, b + n);
+    out_q.push(std::move(o));
+  }, block_size);
+  block b;
+  while (in_q.pop(b)) {
+    if (tc.good()) {
+      tc.feed(b.data);
+    }
+  }
+  reader.join();
+  if (in != stdin) {
+    fclose(in);
+  }
+  size_t trailing = tc.finish();
+  out_q.close();
+  writer.join();
+  if (out != stdout) {
+    write_ok = fclose(out) == 0 && write_ok;
+  } else {
+    write_ok = fflush(out) == 0 && write_ok;
+  }
+  double sec = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+  if (opt.verbose) {
+    fprintf(stderr, "minicode-conv: %zu bytes in, %zu bytes out, %.3f s, %.1f MB/s, %s kernels\n",
+            in_bytes, out_bytes, sec, sec > 0 ? in_bytes / sec / 1e6 : 0.0, minicode::simd_level());
+  }
+  if (!read_ok || !write_ok) {
+    fprintf(stderr, "minicode-conv: i/o error\n");
+    return 2;
+  }
+  if (tc.bad()) {
+    fprintf(stderr, "minicode-conv: invalid input at byte %zu\n", tc.offset());
+    return 1;
+  }
+  if (trailing > 0) {
+    fprintf(stderr, "minicode-conv: incomplete input at byte %zu\n", tc.offset());
+    return 1;
+  }
+  return 0;
+}
+
+static int usage() {
+  fprintf(stderr, "usage: minicode-conv -f FROM -t TO [-o OUTPUT] [-v] [INPUT]\n");
+  fprintf(stderr, "       minicode-conv -l\n");
+  return 2;
+}
+
+int main(int argc, char* argv[]) {
+  minicode::register_cjk_codecs();
+  options opt;
+  for (int i = 1; i < argc; ++i) {
+    string a = argv[i];
+    if ((a == "-f" || a == "-t" || a == "-o") && i + 1 < argc) {
+      const char *v = argv[++i];
+      if (a == "-f") {
+        opt.from = v;
+      } else if (a == "-t") {
+        opt.to = v;
+      } else {
+        opt.output = v;
+      }
+    } else if (a == "-v") {
+      opt.verbose = true;
+    } else if (a == "-l") {
+      for (const minicode::codec* c : minicode::codecs()) {
+        printf("%s%s%s\n", c->name, *c->aliases ? " " : "", c->aliases);
+      }
+      return 0;
+    } else if (a[0] != '-' && opt.input == nullptr) {
+      opt.input = argv[i];
+    } else {
+      return usage();
+    }
+  }
+  if (opt.from.empty() || opt.to.empty()) {
+    return usage();
+  }
+  const minicode::codec *from = minicode::codec_by_name(opt.from);
+  const minicode::codec *to = minicode::codec_by_name(opt.to);
+  if (from == nullptr || to == nullptr) {
+    fprintf(stderr, "minicode-conv: unknown encoding %s\n", (from == nullptr ? opt.from : opt.to).c_str());
+    return 2;
+  }
+  return run(*from, *to, opt);
+}
@@ -1,11 +1,77 @@
 #ifndef _MINICODE_H_
 #define _MINICODE_H_ 1
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+// define MINICODE_NO_SIMD to force the portable scalar kernels
+#if !defined(MINICODE_NO_SIMD)
+#if defined(__AVX2__)
+#define MINICODE_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MINICODE_SSE2 1
+#endif
+#endif
+
+// an sse2 build with gcc or clang also carries the avx2 kernels and picks them
+// when the cpu has avx2, define MINICODE_NO_DISPATCH to leave them out
+#if defined(MINICODE_SSE2) && !defined(MINICODE_AVX2) && !defined(MINICODE_NO_DISPATCH) && \
+    (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MINICODE_AVX2_DISPATCH 1
+#endif
+
+#if defined(MINICODE_AVX2) || defined(MINICODE_AVX2_DISPATCH)
+#define MINICODE_AVX2_KERNELS 1
+#include <immintrin.h>
+#elif defined(MINICODE_SSE2)
+#include <emmintrin.h>
+#endif
+
+// marks the functions that hold avx2 code
+#if defined(MINICODE_AVX2_DISPATCH)
+#define MINICODE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MINICODE_TARGET_AVX2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// file helpers map the input, define MINICODE_NO_FILES to leave them out
+#if !defined(MINICODE_NO_FILES) && (defined(__unix__) || defined(__APPLE__))
+#define MINICODE_FILES 1
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// c++17 builds get std::pmr sequences, define MINICODE_NO_PMR to leave them out
+#if !defined(MINICODE_NO_PMR) && defined(__has_include)
+#if __has_include(<memory_resource>) && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#define MINICODE_PMR 1
+#include <memory_resource>
+#endif
+#endif
+
 namespace minicode {
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -43,21 +109,65 @@ inline bool is_utf8_cont(std::uint8_t b) {
   return (b & 0xc0) == 0x80;
 }
 
+namespace detail {
+
+// count trailing zeros, x must not be 0
+inline int ctz(std::uint32_t x) {
+#if defined(_MSC_VER)
+  unsigned long i;
+  _BitScanForward(&i, x);
+  return static_cast<int>(i);
+#else
+  return __builtin_ctz(x);
+#endif
+}
+
+// index of the highest set bit, x must not be 0
+inline int msb(std::uint32_t x) {
+#if defined(_MSC_VER)
+  unsigned long i;
+  _BitScanReverse(&i, x);
+  return static_cast<int>(i);
+#else
+  return 31 - __builtin_clz(x);
+#endif
+}
+
+inline int popcount(std::uint32_t x) {
+#if defined(_MSC_VER)
+  return static_cast<int>(__popcnt(x));
+#else
+  return __builtin_popcount(x);
+#endif
+}
+
+} // namespace detail
+
 
 ///////////////////////////////////////////////////////////////////////////////
-// exceptions, NOT supported now
+// exceptions, thrown by the errors::raise policy
 ///////////////////////////////////////////////////////////////////////////////
 
 class encode_error: public std::logic_error {
 public:
-  encode_error(const char* s):std::logic_error(s){}
-  encode_error(const std::string& s):std::logic_error(s){}
+  encode_error(const char* s, std::size_t offset = 0):std::logic_error(s), _offset(offset){}
+  encode_error(const std::string& s, std::size_t offset = 0):std::logic_error(s), _offset(offset){}
+  // index of the code point that can not be encoded
+  std::size_t offset() const { return _offset; }
+
+private:
+  std::size_t _offset;
 };
 
 class decode_error: public std::logic_error {
 public:
-  decode_error(const char* s):std::logic_error(s){}
-  decode_error(const std::string& s):std::logic_error(s){}
+  decode_error(const char* s, std::size_t offset = 0):std::logic_error(s), _offset(offset){}
+  decode_error(const std::string& s, std::size_t offset = 0):std::logic_error(s), _offset(offset){}
+  // byte offset of the sequence that can not be decoded
+  std::size_t offset() const { return _offset; }
+
+private:
+  std::size_t _offset;
 };
 
 
@@ -85,488 +195,5565 @@ private:
 };
 
 
+///////////////////////////////////////////////////////////////////////////////
+//  cpu features
+///////////////////////////////////////////////////////////////////////////////
+
+// features of the running cpu, only cpu_avx2 picks kernels, the others are for the caller to read
+enum cpu_feature {
+  cpu_sse2 = 1,
+  cpu_sse42 = 2,
+  cpu_avx2 = 4,
+  cpu_avx512 = 8,
+};
+
+namespace detail {
+
+inline unsigned detect_cpu() {
+  unsigned f = 0;
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  int r[4];
+  __cpuid(r, 0);
+  int top = r[0];
+  __cpuid(r, 1);
+  f |= (r[3] >> 26 & 1) ? cpu_sse2 : 0;
+  f |= (r[2] >> 20 & 1) ? cpu_sse42 : 0;
+  // avx needs the os to save the ymm registers
+  bool ymm = (r[2] >> 27 & 1) && (_xgetbv(0) & 6) == 6;
+  if (top >= 7 && ymm) {
+    __cpuidex(r, 7, 0);
+    f |= (r[1] >> 5 & 1) ? cpu_avx2 : 0;
+    f |= (r[1] >> 16 & 1) && (_xgetbv(0) & 0xe0) == 0xe0 ? cpu_avx512 : 0;
+  }
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+  f |= __builtin_cpu_supports("sse2") ? cpu_sse2 : 0;
+  f |= __builtin_cpu_supports("sse4.2") ? cpu_sse42 : 0;
+  f |= __builtin_cpu_supports("avx2") ? cpu_avx2 : 0;
+  f |= __builtin_cpu_supports("avx512f") ? cpu_avx512 : 0;
+#endif
+  return f;
+}
+
+} // namespace detail
+
+inline unsigned cpu_features() {
+  static const unsigned f = detail::detect_cpu();
+  return f;
+}
+
+namespace detail {
+
+// true when the avx2 kernels run: always in an avx2 build, after a check of the cpu in a dispatching one
+inline bool avx2_enabled() {
+#if defined(MINICODE_AVX2)
+  return true;
+#elif defined(MINICODE_AVX2_DISPATCH)
+  static const bool on = (cpu_features() & cpu_avx2) != 0;
+  return on;
+#else
+  return false;
+#endif
+}
+
+} // namespace detail
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  search
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// ordering key for the two-way factorization
+inline std::uint32_t key(char c) { return static_cast<std::uint8_t>(c); }
+inline std::uint32_t key(const uchar& u) { return u.value(); }
 template<typename T>
-class sequence {
+inline const T& key(const T& t) { return t; }
+
+// first element equal to v in [b, e), e if none
+template<typename T>
+inline const T* find_elem(const T* b, const T* e, const T& v) {
+  return std::find(b, e, v);
+}
+
+inline const char* find_elem(const char* b, const char* e, const char& v) {
+  const void* p = b < e ? std::memchr(b, v, e - b) : nullptr;
+  return p != nullptr ? static_cast<const char*>(p) : e;
+}
+
+#if defined(MINICODE_AVX2_KERNELS)
+// skip the 16-element blocks without v, false when b is at the block holding it
+MINICODE_TARGET_AVX2
+inline bool find_blocks_avx2(const std::uint16_t*& b, const std::uint16_t* e, std::uint16_t v) {
+  const __m256i x16 = _mm256_set1_epi16(static_cast<short>(v));
+  for (; e - b >= 16; b += 16) {
+    __m256i c = _mm256_cmpeq_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b)), x16);
+    int m = _mm256_movemask_epi8(c);
+    if (m != 0) {
+      b += ctz(static_cast<std::uint32_t>(m)) / 2;
+      return false;
+    }
+  }
+  return true;
+}
+
+MINICODE_TARGET_AVX2
+inline bool find_blocks_avx2(const std::uint32_t*& b, const std::uint32_t* e, std::uint32_t v) {
+  const __m256i x8 = _mm256_set1_epi32(static_cast<int>(v));
+  for (; e - b >= 8; b += 8) {
+    __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b)), x8);
+    int m = _mm256_movemask_epi8(c);
+    if (m != 0) {
+      b += ctz(static_cast<std::uint32_t>(m)) / 4;
+      return false;
+    }
+  }
+  return true;
+}
+#endif
+
+inline const std::uint16_t* find_elem(const std::uint16_t* b, const std::uint16_t* e, const std::uint16_t& v) {
+#if defined(MINICODE_AVX2_KERNELS)
+  if (avx2_enabled() && !find_blocks_avx2(b, e, v)) {
+    return b;
+  }
+#endif
+#if defined(MINICODE_SSE2)
+  const __m128i x8 = _mm_set1_epi16(static_cast<short>(v));
+  for (; e - b >= 8; b += 8) {
+    __m128i c = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b)), x8);
+    int m = _mm_movemask_epi8(c);
+    if (m != 0) {
+      return b + ctz(static_cast<std::uint32_t>(m)) / 2;
+    }
+  }
+#endif
+  return std::find(b, e, v);
+}
+
+inline const std::uint32_t* find_elem(const std::uint32_t* b, const std::uint32_t* e, const std::uint32_t& v) {
+#if defined(MINICODE_AVX2_KERNELS)
+  if (avx2_enabled() && !find_blocks_avx2(b, e, v)) {
+    return b;
+  }
+#endif
+#if defined(MINICODE_SSE2)
+  const __m128i x4 = _mm_set1_epi32(static_cast<int>(v));
+  for (; e - b >= 4; b += 4) {
+    __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b)), x4);
+    int m = _mm_movemask_epi8(c);
+    if (m != 0) {
+      return b + ctz(static_cast<std::uint32_t>(m)) / 4;
+    }
+  }
+#endif
+  return std::find(b, e, v);
+}
+
+// a uchar is its 32-bit value
+inline const uchar* find_elem(const uchar* b, const uchar* e, const uchar& v) {
+  const std::uint32_t *u = reinterpret_cast<const std::uint32_t*>(b);
+  return b + (find_elem(u, u + (e - b), v.value()) - u);
+}
+
+// last element equal to v in [b, e), e if none
+template<typename T>
+inline const T* rfind_elem(const T* b, const T* e, const T& v) {
+  for (const T* p = e; p > b; --p) {
+    if (p[-1] == v) {
+      return p - 1;
+    }
+  }
+  return e;
+}
+
+inline const char* rfind_elem(const char* b, const char* e, const char& v) {
+  const char* p = e;
+#if defined(MINICODE_SSE2)
+  const __m128i x = _mm_set1_epi8(v);
+  for (; p - b >= 16; p -= 16) {
+    __m128i c = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p - 16)), x);
+    int m = _mm_movemask_epi8(c);
+    if (m != 0) {
+      return p - 16 + msb(static_cast<std::uint32_t>(m));
+    }
+  }
+#endif
+  const char* r = rfind_elem<char>(b, p, v);
+  return r == p ? e : r;
+}
+
+inline const std::uint16_t* rfind_elem(const std::uint16_t* b, const std::uint16_t* e, const std::uint16_t& v) {
+  const std::uint16_t* p = e;
+#if defined(MINICODE_SSE2)
+  const __m128i x = _mm_set1_epi16(static_cast<short>(v));
+  for (; p - b >= 8; p -= 8) {
+    __m128i c = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p - 8)), x);
+    int m = _mm_movemask_epi8(c);
+    if (m != 0) {
+      return p - 8 + msb(static_cast<std::uint32_t>(m)) / 2;
+    }
+  }
+#endif
+  const std::uint16_t* r = rfind_elem<std::uint16_t>(b, p, v);
+  return r == p ? e : r;
+}
+
+inline const std::uint32_t* rfind_elem(const std::uint32_t* b, const std::uint32_t* e, const std::uint32_t& v) {
+  const std::uint32_t* p = e;
+#if defined(MINICODE_SSE2)
+  const __m128i x = _mm_set1_epi32(static_cast<int>(v));
+  for (; p - b >= 4; p -= 4) {
+    __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p - 4)), x);
+    int m = _mm_movemask_epi8(c);
+    if (m != 0) {
+      return p - 4 + msb(static_cast<std::uint32_t>(m)) / 4;
+    }
+  }
+#endif
+  const std::uint32_t* r = rfind_elem<std::uint32_t>(b, p, v);
+  return r == p ? e : r;
+}
+
+inline const uchar* rfind_elem(const uchar* b, const uchar* e, const uchar& v) {
+  const std::uint32_t *u = reinterpret_cast<const std::uint32_t*>(b);
+  return b + (rfind_elem(u, u + (e - b), v.value()) - u);
+}
+
+// the two-way search runs forward on pointers and backward on reverse iterators,
+// skip() jumps to the next candidate with the element search above
+template<typename T>
+inline const T* skip(const T* b, const T* e, const T& v) {
+  return find_elem(b, e, v);
+}
+
+template<typename T>
+inline std::reverse_iterator<const T*> skip(std::reverse_iterator<const T*> b,
+                                            std::reverse_iterator<const T*> e, const T& v) {
+  const T* p = rfind_elem(e.base(), b.base(), v);
+  return p == b.base() ? e : std::reverse_iterator<const T*>(p + 1);
+}
+
+// critical factorization of the needle, returns the split and sets the period
+template<typename It>
+std::size_t critical_factorization(It nb, std::size_t n, std::size_t& period) {
+  std::size_t ms[2];
+  std::size_t ps[2];
+  for (int rev = 0; rev < 2; ++rev) {
+    // maximal suffix for < and then for >, -1 wraps as in the reference algorithm
+    std::size_t m = std::size_t(-1), j = 0, k = 1, p = 1;
+    while (j + k < n) {
+      auto a = key(nb[j + k]);
+      auto b = key(nb[m + k]);
+      if (rev ? b < a : a < b) {
+        j += k;
+        k = 1;
+        p = j - m;
+      } else if (a == b) {
+        if (k != p) {
+          ++k;
+        } else {
+          j += p;
+          k = 1;
+        }
+      } else {
+        m = j++;
+        k = p = 1;
+      }
+    }
+    ms[rev] = m;
+    ps[rev] = p;
+  }
+  if (ms[1] + 1 < ms[0] + 1) {
+    period = ps[0];
+    return ms[0] + 1;
+  }
+  period = ps[1];
+  return ms[1] + 1;
+}
+
+// two-way string matching (Crochemore and Perrin), linear time and constant space.
+// returns the start of the first match of [nb, nb + n) in [hb, he), he if none.
+template<typename It>
+It two_way(It hb, It he, It nb, std::size_t n) {
+  std::size_t hn = he - hb;
+  if (n == 0) {
+    return hb;
+  }
+  if (n > hn) {
+    return he;
+  }
+  std::size_t period;
+  std::size_t suffix = critical_factorization(nb, n, period);
+  bool periodic = std::equal(nb, nb + suffix, nb + period);
+  if (!periodic) {
+    period = std::max(suffix, n - suffix) + 1;
+  }
+  std::size_t memory = 0;
+  std::size_t j = 0;
+  while (j <= hn - n) {
+    if (memory == 0) {
+      // nothing is remembered, jump to where the right half can start
+      It c = skip(hb + j + suffix, hb + (hn - n + suffix + 1), nb[suffix]);
+      if (c == hb + (hn - n + suffix + 1)) {
+        return he;
+      }
+      j = (c - hb) - suffix;
+    }
+    std::size_t i = std::max(suffix, memory);
+    while (i < n && nb[i] == hb[i + j]) {
+      ++i;
+    }
+    if (i < n) {
+      j += i - suffix + 1;
+      memory = 0;
+      continue;
+    }
+    i = suffix;
+    while (i > memory && nb[i - 1] == hb[i - 1 + j]) {
+      --i;
+    }
+    if (i <= memory) {
+      return hb + j;
+    }
+    j += period;
+    memory = periodic ? n - period : 0;
+  }
+  return he;
+}
+
+// first and last match of [nb, ne) in [hb, he), nullptr if none
+template<typename T>
+inline const T* search(const T* hb, const T* he, const T* nb, const T* ne) {
+  if (ne - nb == 1) {
+    const T* p = find_elem(hb, he, *nb);
+    return p == he ? nullptr : p;
+  }
+  const T* p = two_way(hb, he, nb, ne - nb);
+  return p == he && nb != ne ? nullptr : p;
+}
+
+template<typename T>
+inline const T* rsearch(const T* hb, const T* he, const T* nb, const T* ne) {
+  typedef std::reverse_iterator<const T*> rit;
+  if (ne - nb == 1) {
+    const T* p = rfind_elem(hb, he, *nb);
+    return p == he ? nullptr : p;
+  }
+  rit r = two_way(rit(he), rit(hb), rit(ne), ne - nb);
+  if (r == rit(hb) && nb != ne) {
+    return nullptr;
+  }
+  return r.base() - (ne - nb);
+}
+
+} // namespace detail
+
+
+template<typename T, typename A = std::allocator<T>>
+class sequence;
+
+// non-owning view over a contiguous range, the memory must outlive it
+template<typename T>
+class view {
 public:
-  sequence() = default;
-  sequence(const sequence&) = default;
-  sequence(sequence&&) = default;
-  sequence& operator=(const sequence&) = default;
-  sequence& operator=(sequence&&) = default;
+  view():_data(nullptr),_size(0){}
+  view(const view&) = default;
+  view& operator=(const view&) = default;
 
-  sequence(const T* beg, std::size_t n):_data(beg, beg + n){}
-  sequence(std::size_t n, const T val = T()):_data(n, val){}
+  view(const T* beg, std::size_t n):_data(beg),_size(n){}
+  view(const T* beg, const T* end):_data(beg),_size(end - beg){}
 
-  bool operator==(const sequence& s) const { return _data == s._data; }
-  bool operator!=(const sequence& s) const { return _data != s._data; };
+  // any contiguous container of T: sequence, std::vector, std::string ...
+  template<typename C, typename = typename std::enable_if<
+      std::is_convertible<decltype(std::declval<const C&>().data()), const T*>::value>::type>
+  view(const C& c):_data(c.data()),_size(c.size()){}
 
-  T& operator[](int idx) { return _data[_real_index(idx)]; }
-  const T& operator[](int idx) const { return _data[_real_index(idx)]; }
+  bool operator==(const view& s) const { return _size == s._size && std::equal(_data, _data + _size, s._data); }
+  bool operator!=(const view& s) const { return !(*this == s); }
 
-  std::size_t size() const { return _data.size(); }
+  const T& operator[](int idx) const { return _data[_real_index(idx)]; }
 
-  T* data() { return _data.data(); }
-  const T* data() const { return _data.data(); }
-  const T* limit() const { return _data.data() + _data.size(); }
+  std::size_t size() const { return _size; }
 
-  void assign(const T* b, const T* e) { _data.assign(b, e); }
+  const T* data() const { return _data; }
+  const T* limit() const { return _data + _size; }
 
   int find(const T value, int start, int stop) const {
-    start = _real_index(start);
-    stop = _real_index(stop);
-    if (start < 0) { start = 0; }
-    if (stop > size()) { start = size(); }
-    int ret = -1;
-    for (int i = start; i != stop; ++i) {
-      if (_data[i] == value) {
-        ret = i;
-        break;
-      }
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    if (start >= stop) {
+      return -1;
     }
-    return ret;
+    const T* p = detail::find_elem(_data + start, _data + stop, value);
+    return p == _data + stop ? -1 : p - _data;
   }
 
   int find(const T value, int start) const { return find(value, start, size()); }
   int find(const T value) const { return find(value, 0, size()); }
 
   int rfind(const T value, int start, int stop) const {
-    start = _real_index(start);
-    stop = _real_index(stop);
-    if (start <= 0) { start = -1; }
-    if (stop >= size()) { start = size() - 1; }
-    int ret = -1;
-    for (int i = stop; i != start; --i) {
-      if (_data[i] == value) {
-        ret = i;
-        break;
-      }
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    if (start >= stop) {
+      return -1;
     }
-    return ret;
+    const T* p = detail::rfind_elem(_data + start, _data + stop, value);
+    return p == _data + stop ? -1 : p - _data;
   }
 
   int rfind(const T value, int start) const { return rfind(value, start, size()); }
   int rfind(const T value) const { return rfind(value, 0, size()); }
 
-  sequence subrange(int start, int stop)  const {
-    start = _real_index(start);
-    stop = _real_index(stop);
-    if (start < 0) { start = 0; }
-    if (stop > size()) { start = size(); }
-    if (start < stop) {
-      return sequence(data() + start, stop - start);
-    } else {
-      return sequence();
+  // substring search, an empty sub matches at start (find) or stop (rfind)
+  int find(const view& sub, int start, int stop) const {
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    if (start > stop) {
+      return -1;
     }
+    const T* p = detail::search(_data + start, _data + stop, sub.data(), sub.limit());
+    return p == nullptr ? -1 : p - _data;
   }
 
-private:
-  int _real_index(int idx) const { return idx < 0 ? idx + (int)size() : idx; }
-
-private:
-  std::vector<T> _data;
-};
+  int find(const view& sub, int start) const { return find(sub, start, size()); }
+  int find(const view& sub) const { return find(sub, 0, size()); }
 
-typedef sequence<char> bytes;
-typedef sequence<uchar> str;
+  int rfind(const view& sub, int start, int stop) const {
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    if (start > stop) {
+      return -1;
+    }
+    const T* p = detail::rsearch(_data + start, _data + stop, sub.data(), sub.limit());
+    return p == nullptr ? -1 : p - _data;
+  }
 
+  int rfind(const view& sub, int start) const { return rfind(sub, start, size()); }
+  int rfind(const view& sub) const { return rfind(sub, 0, size()); }
 
-template<typename Encoding>
-class stream {
-public:
-  stream():_pos(0),_state(0){}
-  stream(const stream&) = default;
-  stream(stream&&) = default;
-  stream& operator=(const stream&) = default;
-  stream& operator=(stream&&) = default;
+  // non-overlapping occurrences, an empty sub counts every position
+  int count(const view& sub, int start, int stop) const {
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    if (start > stop) {
+      return 0;
+    }
+    if (sub.size() == 0) {
+      return stop - start + 1;
+    }
+    int n = 0;
+    const T* e = _data + stop;
+    for (const T* p = _data + start; (p = detail::search(p, e, sub.data(), sub.limit())) != nullptr;
+         p += sub.size()) {
+      ++n;
+    }
+    return n;
+  }
 
-  stream(const std::vector<char>& data):_data(data),_pos(0),_state(0){}
-  stream(std::vector<char>&& data):_data(data),_pos(0),_state(0){}
-  stream(const char *data, std::size_t n):_data(data, data + n),_pos(0),_state(0){}
+  int count(const view& sub) const { return count(sub, 0, size()); }
 
-  stream& add_bytes(const std::vector<char>& data) {
-    _data.insert(_data.end(), data.begin(), data.end());
-    _data = std::vector<char>(_data.begin() + _pos, _data.end());
-    _pos = 0;
-    _check_eof();
-    return *this;
+  bool startswith(const view& prefix) const {
+    return prefix.size() <= _size && std::equal(prefix.data(), prefix.limit(), _data);
   }
 
-  stream& add_bytes(const char *data, std::uint32_t n) {
-    _data.insert(_data.end(), data, data + n);
-    _data = std::vector<char>(_data.begin() + _pos, _data.end());
-    _pos = 0;
-    _check_eof();
-    return *this;
+  bool endswith(const view& suffix) const {
+    return suffix.size() <= _size && std::equal(suffix.data(), suffix.limit(), limit() - suffix.size());
   }
 
-  void clear() { _data.clear(); _pos = 0; _state = 0; }
-  int available() const { return _data.size() - _pos; }
-
-  bool get(uchar& uc) {
-    Encoding enc;
-    if (!good()) {
-      return false;
-    }
-    int p = enc(_data.data() + _pos, available(), uc);
-    if (p < 0) {
-      _state |= 2;
-      return false;
+  // pieces between the separators, at most maxsplit splits when it is not negative.
+  // an empty separator does not split.
+  std::vector<view> split(const view& sep, int maxsplit = -1) const {
+    std::vector<view> r;
+    const T* p = _data;
+    const T* e = limit();
+    if (sep.size() > 0) {
+      for (const T* q; maxsplit != 0 && (q = detail::search(p, e, sep.data(), sep.limit())) != nullptr;
+           --maxsplit) {
+        r.push_back(view(p, q));
+        p = q + sep.size();
+      }
     }
-    _pos += p;
-    _check_eof();
-    return true;
+    r.push_back(view(p, e));
+    return r;
   }
 
-  bool peek(uchar& uc) const {
-    Encoding enc;
-    if (!good()) {
-      return false;
+  // copy with at most count occurrences of old replaced by rep, all when count is negative.
+  // the matches are found first, so the result is allocated once.
+  template<typename A = std::allocator<T>>
+  sequence<T, A> replace(const view& old, const view& rep, int count = -1, const A& a = A()) const {
+    std::vector<std::size_t> hits;
+    const T* e = limit();
+    if (old.size() == 0) {
+      for (std::size_t i = 0; i <= _size && count != 0; ++i, --count) {
+        hits.push_back(i);
+      }
+    } else {
+      for (const T* p = _data; count != 0 && (p = detail::search(p, e, old.data(), old.limit())) != nullptr;
+           p += old.size(), --count) {
+        hits.push_back(p - _data);
+      }
     }
-    int p = enc(_data.data() + _pos, available(), uc);
-    if (p < 0) {
-      return false;
+    sequence<T, A> r(_size + hits.size() * rep.size() - hits.size() * old.size(), T(), a);
+    T* o = r.data();
+    std::size_t i = 0;
+    for (std::size_t h : hits) {
+      o = std::copy(_data + i, _data + h, o);
+      o = std::copy(rep.data(), rep.limit(), o);
+      i = h + old.size();
     }
-    return true;
+    std::copy(_data + std::min(i, _size), e, o);
+    return r;
   }
 
-  bool good() const { return _state == 0; }
-  bool eof() const { return (_state & 1) != 0; }
-  bool bad() const { return (_state & 2) != 0; }
+  view subrange(int start, int stop) const {
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    if (start < stop) {
+      return view(_data + start, stop - start);
+    } else {
+      return view();
+    }
+  }
 
 private:
-  void _check_eof() {
-    if (available() == 0) {
-      _state |= 1;
-    }
+  int _real_index(int idx) const { return idx < 0 ? idx + (int)size() : idx; }
+  // python slice rule: negative counts from the end, then clamp to [0, size]
+  int _clamp_index(int idx) const {
+    idx = _real_index(idx);
+    return idx < 0 ? 0 : (idx > (int)size() ? (int)size() : idx);
   }
 
 private:
-  std::vector<char> _data;
-  int _pos;
-  int _state;
+  const T* _data;
+  std::size_t _size;
 };
 
 
-///////////////////////////////////////////////////////////////////////////////
-//  template functions for encode, decode and convert
-///////////////////////////////////////////////////////////////////////////////
+template<typename T, typename A>
+class sequence {
+  typedef std::vector<T, A> _vector;
+public:
+  typedef A allocator_type;
 
-template<typename T>
-int encode(const str& ss, bytes& bs) {
-  const uchar *sb = ss.data();
-  const uchar *se = ss.limit();
-  std::vector<char> b((se -sb) * 4); // enough buff
-  char *bb = b.data();
-  char *be = b.data() + b.size();
-  T t;
-  while (sb < se) {
-    int p = t(*sb, bb, be - bb);
-    if (p < 0) {
-      break;
+  sequence():_small(),_alloc(),_len(0){}
+  sequence(const sequence& s)
+    :_small(),_alloc(std::allocator_traits<A>::select_on_container_copy_construction(s._alloc)),_len(0) {
+    assign(s.data(), s.limit());
+  }
+  sequence(sequence&& s) noexcept:_small(),_alloc(s._alloc),_len(0) {
+    if (s._on_heap()) {
+      _adopt(std::move(s._heap));
     } else {
-      ++sb;
-      bb += p;
+      std::copy(s._small, s._small + s._len, _small);
+      _len = s._len;
     }
+    s._free();
   }
-  bs.assign(b.data(), bb);
-  return se - sb;
-}
-
-template<typename T>
-int decode(const bytes& bs, str& ss) {
-  const char *bb = bs.data();
-  const char *be = bs.data() + bs.size();
-  std::vector<uchar> s(bs.size()); // enough buff
-  uchar *sb = s.data();
-  T t;
-  while (bb < be) {
-    int p = t(bb, be - bb, *sb);
-    if (p < 0) {
-      break;
-    } else {
-      bb += p;
-      ++sb;
+  sequence& operator=(const sequence& s) {
+    if (this != &s) {
+      assign(s.data(), s.limit());
     }
+    return *this;
   }
-  ss.assign(s.data(), sb);
-  return be - bb;
-}
-
-template<typename T1, typename T2>
-int convert(const bytes& b1, bytes& b2) {
-  const char *b1b = b1.data();
-  const char *b1e = b1.limit();
-  std::vector<char> b((b1e - b1b) * 4); // enough buff
-  char* bb = b.data();
-  const char* be = b.data() + b.size();
-  T1 t1;
-  T2 t2;
-  while (b1b < b1e) {
-    uchar u;
-    int p = t1(b1b, b1e - b1b, u);
-    if (p < 0) {
-      break;
-    } else {
-      b1b += p;
-      int q = t2(u, bb, be - bb);
-      if (q < 0) {
-        break;
+  sequence& operator=(sequence&& s) noexcept(std::is_nothrow_move_assignable<_vector>::value) {
+    if (this != &s) {
+      if (s._on_heap()) {
+        _adopt(std::move(s._heap));
       } else {
-        bb += q;
+        _free();
+        std::copy(s._small, s._small + s._len, _small);
+        _len = s._len;
       }
+      s._free();
     }
+    return *this;
   }
-  b2.assign(b.data(), bb);
-  return b1e - b1b;
-}
+  ~sequence() { _free(); }
 
+  explicit sequence(const A& a):_small(),_alloc(a),_len(0){}
+  sequence(const T* beg, std::size_t n, const A& a = A()):_small(),_alloc(a),_len(0) { assign(beg, beg + n); }
+  sequence(std::size_t n, const T val = T(), const A& a = A()):_small(),_alloc(a),_len(0) {
+    resize(n);
+    std::fill(data(), data() + n, val);
+  }
+  explicit sequence(const view<T>& v, const A& a = A()):_small(),_alloc(a),_len(0) { assign(v.data(), v.limit()); }
+  // take over the memory of v, nothing is copied
+  explicit sequence(std::vector<T, A>&& v):_small(),_alloc(v.get_allocator()),_len(0) { _adopt(std::move(v)); }
 
-///////////////////////////////////////////////////////////////////////////////
-//  encode and decode operators of each encoding
-///////////////////////////////////////////////////////////////////////////////
+  // hand the contents over as a vector and leave the sequence empty,
+  // only contents short enough to be inline are copied.
+  std::vector<T, A> release() {
+    std::vector<T, A> r(_alloc);
+    if (_on_heap()) {
+      r.swap(_heap);
+    } else {
+      r.assign(_small, _small + _len);
+      _len = 0;
+    }
+    return r;
+  }
 
-struct ascii {
-  int operator()(const char *bs, int n, uchar& uc) {
-    assert(n > 0);
-    std::uint32_t& u = uc.value();
-    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
-    if (bss[0] < 0x80) {
-      u = bss[0];
-      return 1;
+  A get_allocator() const { return _alloc; }
+
+  bool operator==(const sequence& s) const { return as_view() == s.as_view(); }
+  bool operator!=(const sequence& s) const { return !(*this == s); };
+
+  T& operator[](int idx) { return data()[_real_index(idx)]; }
+  const T& operator[](int idx) const { return data()[_real_index(idx)]; }
+
+  std::size_t size() const { return _on_heap() ? _heap.size() : _len; }
+
+  T* data() { return _on_heap() ? _heap.data() : _small; }
+  const T* data() const { return _on_heap() ? _heap.data() : _small; }
+  const T* limit() const { return data() + size(); }
+
+  void assign(const T* b, const T* e) {
+    std::size_t n = e - b;
+    if (_on_heap()) {
+      _heap.assign(b, e);
+    } else if (n <= _small_size) {
+      std::copy(b, e, _small);
+      _len = static_cast<unsigned char>(n);
     } else {
-      return -1;
+      _adopt(_vector(b, e, _alloc));
     }
   }
 
-  int operator()(const uchar uc, char *bs, int n) {
-    assert(n > 0);
-    const std::uint32_t u = uc.value();
-    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
-    if (u < 0x80) {
-      bss[0] = u;
-      return 1;
+  void resize(std::size_t n) {
+    if (_on_heap()) {
+      _heap.resize(n);
+    } else if (n <= _small_size) {
+      std::fill(_small + std::min<std::size_t>(_len, n), _small + n, T());
+      _len = static_cast<unsigned char>(n);
     } else {
-      return -1;
+      _vector v(_alloc);
+      v.reserve(n);
+      v.insert(v.end(), _small, _small + std::min<std::size_t>(_len, _small_size));
+      v.resize(n);
+      _adopt(std::move(v));
     }
   }
-};
 
-struct utf8 {
-  int operator()(const char *bs, int n, uchar& uc) {
-    assert(n > 0);
-    std::uint32_t& u = uc.value();
-    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
-    if(bss[0] < 0x80 && n >= 1) {
-      u = bss[0];
-      return 1;
-    } else if (bss[0] < 0xe0 &&
-               n >= 2 &&
-               is_utf8_cont(bss[1])) {
-      u = ((bss[0] & 0x1f) << 6) |
-          (bss[1] & 0x3f);
-      return 2;
-    } else if (bss[0] < 0xf0 &&
-               n >= 3 &&
-               is_utf8_cont(bss[1]) &&
-               is_utf8_cont(bss[2])) {
-      u = ((bss[0] & 0x0f) << 12) |
-          ((bss[1] & 0x3f) << 6) |
-          (bss[2] & 0x3f);
-      return 3;
-    } else if (bss[0] < 0xf8 &&
-               n >= 4 &&
-               is_utf8_cont(bss[1]) &&
-               is_utf8_cont(bss[2]) &&
-               is_utf8_cont(bss[3])) {
-      u = ((bss[0] & 0x07) << 18) |
-          ((bss[1] & 0x3f) << 12) |
-          ((bss[2] & 0x3f) << 6) |
-          (bss[3] & 0x3f);
-      return 4;
+  // the memory on the heap is kept, as std::vector::clear keeps it
+  void clear() {
+    if (_on_heap()) {
+      _heap.clear();
     } else {
-      return -1;
+      _len = 0;
     }
   }
 
-  int operator()(const uchar uc, char* bs, int n) {
-    assert(n > 0);
-    const std::uint32_t u = uc.value();
-    if (!is_valid_unicode(u)) {
-      return -1;
-    }
-    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
-    if(u < 0x80 && n >= 1) {
-      bss[0] = u;
-      return 1;
-    } else if (u < 0x800 && n >= 2) {
-      bss[0] = (u & 07700) >> 6 | 0300;
-      bss[1] = (u & 077) | 0200;
-      return 2;
-    } else if (u < 0x10000 && n >= 3) {
-      bss[0] = (u & 0770000) >> 12 | 0340;
-      bss[1] = (u & 07700) >> 6 | 0200;
-      bss[2] = (u & 077) | 0200;
-      return 3;
-    } else if (u < 0x110000 && n >= 4) {
-      bss[0] = (u & 077000000) >> 18 | 0360;
-      bss[1] = (u & 0770000) >> 12 | 0200;
-      bss[2] = (u & 07700) >> 6 | 0200;
-      bss[3] = (u & 077) | 0200;
-      return 4;
-    } else {
-      return -1;
+  view<T> as_view() const { return view<T>(data(), size()); }
+
+  int find(const T value, int start, int stop) const { return as_view().find(value, start, stop); }
+  int find(const T value, int start) const { return find(value, start, size()); }
+  int find(const T value) const { return find(value, 0, size()); }
+
+  int rfind(const T value, int start, int stop) const { return as_view().rfind(value, start, stop); }
+  int rfind(const T value, int start) const { return rfind(value, start, size()); }
+  int rfind(const T value) const { return rfind(value, 0, size()); }
+
+  int find(const view<T>& sub, int start, int stop) const { return as_view().find(sub, start, stop); }
+  int find(const view<T>& sub, int start) const { return find(sub, start, size()); }
+  int find(const view<T>& sub) const { return find(sub, 0, size()); }
+
+  int rfind(const view<T>& sub, int start, int stop) const { return as_view().rfind(sub, start, stop); }
+  int rfind(const view<T>& sub, int start) const { return rfind(sub, start, size()); }
+  int rfind(const view<T>& sub) const { return rfind(sub, 0, size()); }
+
+  int count(const view<T>& sub, int start, int stop) const { return as_view().count(sub, start, stop); }
+  int count(const view<T>& sub) const { return count(sub, 0, size()); }
+
+  bool startswith(const view<T>& prefix) const { return as_view().startswith(prefix); }
+  bool endswith(const view<T>& suffix) const { return as_view().endswith(suffix); }
+
+  std::vector<sequence> split(const view<T>& sep, int maxsplit = -1) const {
+    std::vector<view<T>> vs = as_view().split(sep, maxsplit);
+    std::vector<sequence> r;
+    r.reserve(vs.size());
+    for (const view<T>& v : vs) {
+      r.push_back(sequence(v, get_allocator()));
     }
+    return r;
   }
-};
 
-struct utf16le {
-  int operator()(const char *bs, int n, uchar& uc) {
-    assert(n >= 2);
-    std::uint32_t& u = uc.value();
-    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
-    std::uint32_t x = bss[0] | (bss[1] << 8);
-    if (is_valid_unicode(x) && n >= 2) {
-      u = x;
-      return 2;
-    } else if (is_surrogate_high(x) && x >= 4){
-      std::uint32_t y = bss[2] | (bss[3] << 8);
-      if (is_surrogate_low(y)) {
-        u = surrogate_combine(x, y);
-        return 4;
-      } else {
-        return -1;
-      }
-    } else {
-      return -1;
-    }
+  sequence replace(const view<T>& old, const view<T>& rep, int count = -1) const {
+    return as_view().replace(old, rep, count, get_allocator());
   }
 
-  int operator()(const uchar uc, char* bs, int n) {
-    assert(n >= 2);
-    const std::uint32_t u = uc.value();
-    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
-    if (u < 0x10000 && !is_surrogate(u) && n >= 2) {
-      bss[0] = u & 0xff;
-      bss[1] = (u >> 8) & 0xff;
-      return 2;
-    } else if (0x10000 <= u && u <= 0x10ffff && n >= 4) {
-      std::uint32_t x, y;
-      surrogate_split(u, x, y);
-      bss[0] = x & 0xff;
-      bss[1] = (x >> 8) & 0xff;
-      bss[2] = y & 0xff;
-      bss[3] = (y >> 8) & 0xff;
-      return 4;
-    } else {
-      return -1;
-    }
+  sequence subrange(int start, int stop) const {
+    return sequence(as_view().subrange(start, stop), get_allocator());
   }
-};
 
-struct utf16be {
-  int operator()(const char *bs, int n, uchar& uc) {
-    assert(n >= 2);
-    std::uint32_t& u = uc.value();
-    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
-    std::uint32_t x = bss[1] | (bss[0] << 8);
-    if (is_valid_unicode(x) && n >= 2) {
-      u = x;
-      return 2;
-    } else if (is_surrogate_high(x) && x >= 4){
-      std::uint32_t y = bss[3] | (bss[2] << 8);
-      if (is_surrogate_low(y)) {
-        u = surrogate_combine(x, y);
-        return 4;
-      } else {
-        return -1;
-      }
+private:
+  int _real_index(int idx) const { return idx < 0 ? idx + (int)size() : idx; }
+
+  bool _on_heap() const { return _len == _heap_tag; }
+
+  // move the contents of v in, with its allocator when the contents were inline
+  void _adopt(_vector&& v) {
+    if (_on_heap()) {
+      _heap = std::move(v);
     } else {
-      return -1;
+      ::new (static_cast<void*>(&_heap)) _vector(std::move(v));
+      _len = _heap_tag;
     }
+    _alloc = _heap.get_allocator();
   }
 
-  int operator()(const uchar uc, char* bs, int n) {
-    assert(n >= 2);
-    const std::uint32_t u = uc.value();
-    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
-    if (u < 0x10000 && !is_surrogate(u) && n >= 2) {
-      bss[1] = u & 0xff;
-      bss[0] = (u >> 8) & 0xff;
-      return 2;
-    } else if (0x10000 <= u && u <= 0x10ffff && n >= 4) {
-      std::uint32_t x, y;
-      surrogate_split(u, x, y);
-      bss[1] = x & 0xff;
-      bss[0] = (x >> 8) & 0xff;
-      bss[3] = y & 0xff;
-      bss[2] = (y >> 8) & 0xff;
-      return 4;
-    } else {
-      return -1;
+  // back to empty inline contents, _heap is destroyed when it is live
+  void _free() {
+    if (_on_heap()) {
+      _heap.~_vector();
     }
+    _len = 0;
   }
+
+private:
+  // the room of three pointers, what a std::vector takes, 24 bytes or 6 code points
+  enum { _small_size = 3 * sizeof(void*) / sizeof(T) > 0 ? 3 * sizeof(void*) / sizeof(T) : 1 };
+  enum { _heap_tag = 0xff };
+
+  // the contents are inline in _small, or in _heap which is only live while _len is _heap_tag
+  union {
+    _vector _heap;
+    T _small[_small_size];
+  };
+  A _alloc;
+  unsigned char _len;
 };
 
-struct utf32le {
-  int operator()(const char *bs, int n, uchar& uc) {
-    assert(n >= 4);
-    std::uint32_t& u = uc.value();
-    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
-    std::uint32_t x = bss[0] | (bss[1] << 8) | (bss[2] << 16) | (bss[3] << 24);
-    if (is_valid_unicode(x)) {
-      u = x;
-      return 4;
-    } else {
-      return -1;
+typedef sequence<char> bytes;
+typedef sequence<uchar> str;
+typedef view<char> bytes_view;
+typedef view<uchar> str_view;
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  arena allocation
+///////////////////////////////////////////////////////////////////////////////
+
+// bump allocation out of large blocks, nothing is freed until release().
+// meant for a batch of short-lived sequences that all die together,
+// sequence<T, arena_allocator<T>> takes it, and std::pmr sequences in c++17.
+#if defined(MINICODE_PMR)
+class arena: public std::pmr::memory_resource {
+#else
+class arena {
+#endif
+public:
+  explicit arena(std::size_t block_size = 64 * 1024)
+    :_block_size(block_size),_p(nullptr),_e(nullptr),_used(0){}
+  arena(const arena&) = delete;
+  arena& operator=(const arena&) = delete;
+
+#if !defined(MINICODE_PMR)
+  void* allocate(std::size_t n, std::size_t align = alignof(std::max_align_t)) { return _bump(n, align); }
+  void deallocate(void*, std::size_t, std::size_t = alignof(std::max_align_t)) {}
+#endif
+
+  // give back everything at once, the first block is kept for the next batch
+  void release() {
+    _p = _e = nullptr;
+    if (!_blocks.empty()) {
+      _blocks.resize(1);
+      _p = _blocks[0].first.get();
+      _e = _p + _blocks[0].second;
     }
+    _used = 0;
   }
 
-  int operator()(const uchar uc, char* bs, int n) {
-    assert(n >= 4);
-    const std::uint32_t u = uc.value();
-    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
-    if (is_valid_unicode(u)) {
-      bss[0] = u & 0xff;
-      bss[1] = (u >> 8) & 0xff;
-      bss[2] = (u >> 16) & 0xff;
-      bss[3] = (u >>24) & 0xff;
-      return 4;
-    } else {
-      return -1;
-    }
+  // bytes handed out since the last release
+  std::size_t used() const { return _used; }
+
+#if defined(MINICODE_PMR)
+protected:
+  void* do_allocate(std::size_t n, std::size_t align) override { return _bump(n, align); }
+  void do_deallocate(void*, std::size_t, std::size_t) override {}
+  bool do_is_equal(const std::pmr::memory_resource& r) const noexcept override { return this == &r; }
+#endif
+
+private:
+  static std::size_t _pad(const char* p, std::size_t align) {
+    return (align - reinterpret_cast<std::uintptr_t>(p) % align) % align;
   }
-};
 
-struct utf32be {
-  int operator()(const char *bs, int n, uchar& uc) {
-    assert(n >= 4);
-    std::uint32_t& u = uc.value();
-    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
-    std::uint32_t x = bss[3] | (bss[2] << 8) | (bss[1] << 16) | (bss[0] << 24);
-    if (is_valid_unicode(x)) {
-      u = x;
-      return 4;
-    } else {
-      return -1;
+  void* _bump(std::size_t n, std::size_t align) {
+    _used += n;
+    if (_p != nullptr) {
+      std::size_t k = _pad(_p, align);
+      if (k <= static_cast<std::size_t>(_e - _p) && n <= static_cast<std::size_t>(_e - _p) - k) {
+        char *p = _p + k;
+        _p = p + n;
+        return p;
+      }
+    }
+    if (n + align > _block_size / 2) {
+      // a large one gets a block of its own, the current block goes on
+      char *b = _new_block(n + align);
+      return b + _pad(b, align);
     }
+    _p = _new_block(_block_size);
+    _e = _p + _block_size;
+    char *p = _p + _pad(_p, align);
+    _p = p + n;
+    return p;
   }
 
-  int operator()(const uchar uc, char* bs, int n) {
-    assert(n >= 4);
-    const std::uint32_t u = uc.value();
-    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
-    if (is_valid_unicode(u)) {
-      bss[3] = u & 0xff;
-      bss[2] = (u >> 8) & 0xff;
-      bss[1] = (u >> 16) & 0xff;
-      bss[0] = (u >>24) & 0xff;
-      return 4;
-    } else {
-      return -1;
-    }
+  char* _new_block(std::size_t n) {
+    _blocks.emplace_back(std::unique_ptr<char[]>(new char[n]), n);
+    return _blocks.back().first.get();
   }
+
+private:
+  std::size_t _block_size;
+  std::vector<std::pair<std::unique_ptr<char[]>, std::size_t>> _blocks;
+  char *_p;
+  char *_e;
+  std::size_t _used;
+};
+
+// a std allocator over an arena, sequences made with it share the arena
+template<typename T>
+class arena_allocator {
+public:
+  typedef T value_type;
+
+  arena_allocator(arena& a):_arena(&a){}
+  template<typename U>
+  arena_allocator(const arena_allocator<U>& a):_arena(a._arena){}
+
+  T* allocate(std::size_t n) { return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T))); }
+  void deallocate(T*, std::size_t) {}
+
+  template<typename U>
+  bool operator==(const arena_allocator<U>& a) const { return _arena == a._arena; }
+  template<typename U>
+  bool operator!=(const arena_allocator<U>& a) const { return _arena != a._arena; }
+
+private:
+  template<typename U>
+  friend class arena_allocator;
+
+  arena *_arena;
 };
 
+template<typename T>
+using arena_sequence = sequence<T, arena_allocator<T>>;
+typedef arena_sequence<char> arena_bytes;
+typedef arena_sequence<uchar> arena_str;
+
+#if defined(MINICODE_PMR)
+namespace pmr {
+
+template<typename T>
+using sequence = minicode::sequence<T, std::pmr::polymorphic_allocator<T>>;
+typedef sequence<char> bytes;
+typedef sequence<uchar> str;
+
+} // namespace pmr
+#endif
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  bulk kernels
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// true if [ab, ae) and [bb, be) share memory
+template<typename T>
+inline bool overlaps(const T* ab, const T* ae, const T* bb, const T* be) {
+  std::less<const T*> lt;
+  return lt(ab, be) && lt(bb, ae);
+}
+
+// the functors take an int length, none of them needs more than a few bytes
+inline int clamp_len(std::ptrdiff_t n) {
+  return n > 0x7fffffff ? 0x7fffffff : static_cast<int>(n);
+}
+
+// bulk kernels advance the pointers as far as they can,
+// and stop at the first error, the end of input or when the output is full.
+// the scalar ones drive the per code point functors,
+// they are the fallback for user-defined encodings and the portable runtime kernels.
+template<typename T>
+struct scalar {
+  static void decode(const char*& bb, const char* be, uchar*& sb, uchar* se) {
+    T t;
+    while (bb < be && sb < se) {
+      int p = t(bb, clamp_len(be - bb), *sb);
+      if (p < 0) {
+        break;
+      }
+      bb += p;
+      ++sb;
+    }
+  }
+
+  static void encode(const uchar*& sb, const uchar* se, char*& bb, char* be) {
+    T t;
+    while (sb < se && bb < be) {
+      int p = t(*sb, bb, clamp_len(be - bb));
+      if (p < 0) {
+        break;
+      }
+      ++sb;
+      bb += p;
+    }
+  }
+};
+
+template<typename T, typename = void>
+struct bulk: scalar<T> {};
+
+#if defined(MINICODE_AVX2_KERNELS)
+// the 32-byte blocks of decode_ascii
+MINICODE_TARGET_AVX2
+inline void decode_ascii_avx2(const char*& bb, const char* be, uchar*& sb, uchar* se) {
+  while (be - bb >= 32 && se - sb >= 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bb));
+    std::uint32_t m = static_cast<std::uint32_t>(_mm256_movemask_epi8(v));
+    if (m != 0) {
+      break;
+    }
+    __m256i *d = reinterpret_cast<__m256i*>(sb);
+    for (int i = 0; i < 4; ++i) {
+      __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(bb + i * 8));
+      _mm256_storeu_si256(d + i, _mm256_cvtepu8_epi32(x));
+    }
+    bb += 32;
+    sb += 32;
+  }
+}
+#endif
+
+// widen the leading ascii run of [bb, be) into [sb, se)
+inline void decode_ascii(const char*& bb, const char* be, uchar*& sb, uchar* se) {
+  static_assert(sizeof(uchar) == 4, "uchar must be a plain 32-bit value");
+#if defined(MINICODE_AVX2_KERNELS)
+  if (avx2_enabled()) {
+    decode_ascii_avx2(bb, be, sb, se);
+  }
+#endif
+#if defined(MINICODE_SSE2)
+  const __m128i z = _mm_setzero_si128();
+  while (be - bb >= 16 && se - sb >= 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bb));
+    if (_mm_movemask_epi8(v) != 0) {
+      break;
+    }
+    __m128i lo = _mm_unpacklo_epi8(v, z);
+    __m128i hi = _mm_unpackhi_epi8(v, z);
+    __m128i *d = reinterpret_cast<__m128i*>(sb);
+    _mm_storeu_si128(d + 0, _mm_unpacklo_epi16(lo, z));
+    _mm_storeu_si128(d + 1, _mm_unpackhi_epi16(lo, z));
+    _mm_storeu_si128(d + 2, _mm_unpacklo_epi16(hi, z));
+    _mm_storeu_si128(d + 3, _mm_unpackhi_epi16(hi, z));
+    bb += 16;
+    sb += 16;
+  }
+#endif
+  while (bb < be && sb < se && static_cast<std::uint8_t>(*bb) < 0x80) {
+    sb->value() = static_cast<std::uint8_t>(*bb);
+    ++bb;
+    ++sb;
+  }
+}
+
+#if defined(MINICODE_AVX2_KERNELS)
+// the 32-element blocks of encode_ascii
+MINICODE_TARGET_AVX2
+inline void encode_ascii_avx2(const uchar*& sb, const uchar* se, char*& bb, char* be) {
+  const __m256i m8 = _mm256_set1_epi32(~0x7f);
+  while (se - sb >= 32 && be - bb >= 32) {
+    const __m256i *s = reinterpret_cast<const __m256i*>(sb);
+    __m256i a = _mm256_loadu_si256(s + 0);
+    __m256i b = _mm256_loadu_si256(s + 1);
+    __m256i c = _mm256_loadu_si256(s + 2);
+    __m256i d = _mm256_loadu_si256(s + 3);
+    __m256i o = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+    if (!_mm256_testz_si256(o, m8)) {
+      break;
+    }
+    // packs work in 128-bit lanes, fix the order with a final permute
+    __m256i ab = _mm256_packs_epi32(a, b);
+    __m256i cd = _mm256_packs_epi32(c, d);
+    __m256i x = _mm256_packus_epi16(ab, cd);
+    x = _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(bb), x);
+    sb += 32;
+    bb += 32;
+  }
+}
+#endif
+
+// narrow the leading ascii run of [sb, se) into [bb, be)
+inline void encode_ascii(const uchar*& sb, const uchar* se, char*& bb, char* be) {
+#if defined(MINICODE_AVX2_KERNELS)
+  if (avx2_enabled()) {
+    encode_ascii_avx2(sb, se, bb, be);
+  }
+#endif
+#if defined(MINICODE_SSE2)
+  const __m128i m7 = _mm_set1_epi32(~0x7f);
+  const __m128i z = _mm_setzero_si128();
+  while (se - sb >= 16 && be - bb >= 16) {
+    const __m128i *s = reinterpret_cast<const __m128i*>(sb);
+    __m128i a = _mm_loadu_si128(s + 0);
+    __m128i b = _mm_loadu_si128(s + 1);
+    __m128i c = _mm_loadu_si128(s + 2);
+    __m128i d = _mm_loadu_si128(s + 3);
+    __m128i o = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+    o = _mm_cmpeq_epi32(_mm_and_si128(o, m7), z);
+    if (_mm_movemask_epi8(o) != 0xffff) {
+      break;
+    }
+    __m128i x = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(bb), x);
+    sb += 16;
+    bb += 16;
+  }
+#endif
+  while (sb < se && bb < be && sb->value() < 0x80) {
+    *bb = static_cast<char>(sb->value());
+    ++sb;
+    ++bb;
+  }
+}
+
+#if defined(MINICODE_SSE2)
+// pack eight 32-bit lanes holding values below 0x10000
+inline __m128i pack32to16(__m128i a, __m128i b) {
+  __m128i k = _mm_set1_epi32(0x8000);
+  __m128i x = _mm_packs_epi32(_mm_sub_epi32(a, k), _mm_sub_epi32(b, k));
+  return _mm_add_epi16(x, _mm_set1_epi16(static_cast<short>(0x8000)));
+}
+#endif
+
+// widen n code units to uchar, and narrow uchar to units that are known to fit them
+
+inline void widen(const std::uint8_t* b, std::size_t n, uchar* s) {
+  std::size_t i = 0;
+#if defined(MINICODE_SSE2)
+  const __m128i z = _mm_setzero_si128();
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    __m128i lo = _mm_unpacklo_epi8(v, z);
+    __m128i hi = _mm_unpackhi_epi8(v, z);
+    __m128i *d = reinterpret_cast<__m128i*>(s + i);
+    _mm_storeu_si128(d + 0, _mm_unpacklo_epi16(lo, z));
+    _mm_storeu_si128(d + 1, _mm_unpackhi_epi16(lo, z));
+    _mm_storeu_si128(d + 2, _mm_unpacklo_epi16(hi, z));
+    _mm_storeu_si128(d + 3, _mm_unpackhi_epi16(hi, z));
+  }
+#endif
+  for (; i < n; ++i) {
+    s[i].value() = b[i];
+  }
+}
+
+inline void widen(const std::uint16_t* b, std::size_t n, uchar* s) {
+  std::size_t i = 0;
+#if defined(MINICODE_SSE2)
+  const __m128i z = _mm_setzero_si128();
+  for (; i + 8 <= n; i += 8) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    __m128i *d = reinterpret_cast<__m128i*>(s + i);
+    _mm_storeu_si128(d + 0, _mm_unpacklo_epi16(v, z));
+    _mm_storeu_si128(d + 1, _mm_unpackhi_epi16(v, z));
+  }
+#endif
+  for (; i < n; ++i) {
+    s[i].value() = b[i];
+  }
+}
+
+inline void widen(const std::uint32_t* b, std::size_t n, uchar* s) {
+  for (std::size_t i = 0; i < n; ++i) {
+    s[i].value() = b[i];
+  }
+}
+
+inline void narrow(const uchar* s, std::size_t n, std::uint8_t* b) {
+  std::size_t i = 0;
+#if defined(MINICODE_SSE2)
+  for (; i + 16 <= n; i += 16) {
+    const __m128i *d = reinterpret_cast<const __m128i*>(s + i);
+    __m128i x = _mm_packus_epi16(
+        _mm_packs_epi32(_mm_loadu_si128(d + 0), _mm_loadu_si128(d + 1)),
+        _mm_packs_epi32(_mm_loadu_si128(d + 2), _mm_loadu_si128(d + 3)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(b + i), x);
+  }
+#endif
+  for (; i < n; ++i) {
+    b[i] = static_cast<std::uint8_t>(s[i].value());
+  }
+}
+
+inline void narrow(const uchar* s, std::size_t n, std::uint16_t* b) {
+  std::size_t i = 0;
+#if defined(MINICODE_SSE2)
+  for (; i + 8 <= n; i += 8) {
+    const __m128i *d = reinterpret_cast<const __m128i*>(s + i);
+    __m128i x = pack32to16(_mm_loadu_si128(d + 0), _mm_loadu_si128(d + 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(b + i), x);
+  }
+#endif
+  for (; i < n; ++i) {
+    b[i] = static_cast<std::uint16_t>(s[i].value());
+  }
+}
+
+inline void narrow(const uchar* s, std::size_t n, std::uint32_t* b) {
+  for (std::size_t i = 0; i < n; ++i) {
+    b[i] = s[i].value();
+  }
+}
+
+// bitwise or of all the code points, it crosses 0x100 and 0x10000 when the maximum does
+inline std::uint32_t or_all(const uchar* s, std::size_t n) {
+  std::uint32_t r = 0;
+  std::size_t i = 0;
+#if defined(MINICODE_SSE2)
+  __m128i acc = _mm_setzero_si128();
+  for (; i + 4 <= n; i += 4) {
+    acc = _mm_or_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i)));
+  }
+  acc = _mm_or_si128(acc, _mm_srli_si128(acc, 8));
+  acc = _mm_or_si128(acc, _mm_srli_si128(acc, 4));
+  r = static_cast<std::uint32_t>(_mm_cvtsi128_si32(acc));
+#endif
+  for (; i < n; ++i) {
+    r |= s[i].value();
+  }
+  return r;
+}
+
+// latin-1 to utf-8, ascii blocks are copied as they are
+inline void latin1_to_utf8(const std::uint8_t*& ib, const std::uint8_t* ie, char*& ob, char* oe) {
+  while (ib < ie) {
+#if defined(MINICODE_SSE2)
+    while (ie - ib >= 16 && oe - ob >= 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ib));
+      if (_mm_movemask_epi8(v) != 0) {
+        break;
+      }
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(ob), v);
+      ib += 16;
+      ob += 16;
+    }
+    if (ib == ie) {
+      break;
+    }
+#endif
+    std::uint8_t c = *ib;
+    if (c < 0x80 && ob < oe) {
+      *ob++ = static_cast<char>(c);
+    } else if (c >= 0x80 && oe - ob >= 2) {
+      *ob++ = static_cast<char>(0xc0 | c >> 6);
+      *ob++ = static_cast<char>(0x80 | (c & 0x3f));
+    } else {
+      break;
+    }
+    ++ib;
+  }
+}
+
+// length of a well-formed utf-8 sequence at b, 0 if it is not.
+// stricter than the utf8 functor: no overlong forms, surrogates or values above 0x10ffff.
+inline int utf8_strict_len(const std::uint8_t* b, std::ptrdiff_t n) {
+  if (b[0] < 0x80) {
+    return 1;
+  } else if (b[0] < 0xc2) {
+    return 0;
+  } else if (b[0] < 0xe0) {
+    return n >= 2 && is_utf8_cont(b[1]) ? 2 : 0;
+  } else if (b[0] < 0xf0) {
+    if (n < 3 || !is_utf8_cont(b[1]) || !is_utf8_cont(b[2])) {
+      return 0;
+    }
+    if ((b[0] == 0xe0 && b[1] < 0xa0) || (b[0] == 0xed && b[1] >= 0xa0)) {
+      return 0;
+    }
+    return 3;
+  } else if (b[0] < 0xf5) {
+    if (n < 4 || !is_utf8_cont(b[1]) || !is_utf8_cont(b[2]) || !is_utf8_cont(b[3])) {
+      return 0;
+    }
+    if ((b[0] == 0xf0 && b[1] < 0x90) || (b[0] == 0xf4 && b[1] >= 0x90)) {
+      return 0;
+    }
+    return 4;
+  } else {
+    return 0;
+  }
+}
+
+// number of bytes in [b, b + n) that are not utf-8 continuation,
+// that is the number of code points in well-formed utf-8
+inline std::size_t count_leads(const char* b, std::size_t n) {
+  std::size_t r = 0;
+  std::size_t i = 0;
+#if defined(MINICODE_SSE2)
+  const __m128i c0 = _mm_set1_epi8(static_cast<char>(0xc0));
+  const __m128i c8 = _mm_set1_epi8(static_cast<char>(0x80));
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    int m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, c0), c8));
+    r += 16 - popcount(static_cast<std::uint32_t>(m));
+  }
+#endif
+  for (; i < n; ++i) {
+    r += !is_utf8_cont(b[i]);
+  }
+  return r;
+}
+
+// unit size and byte order of the utf encodings,
+// 1 marks the single byte table codecs, 2 the multi byte ones of minicode_cjk.h, 0 anything else
+template<typename T, typename = void>
+struct utf_traits {
+  static const int bits = 0;
+  static const bool big = false;
+};
+
+// true if [bs, bs + n) is the beginning of a sequence and only needs more bytes.
+// the primary template knows nothing about the encoding, so any error is final.
+template<typename T, int B = utf_traits<T>::bits>
+struct partial {
+  static bool test(const char*, std::size_t) { return false; }
+};
+
+// move pos forward to a code point boundary that the serial loops would reach,
+// for splitting the input. the primary template can not split.
+template<typename T, int B = utf_traits<T>::bits>
+struct boundary {
+  static const bool splittable = false;
+  static std::size_t next(const char*, std::size_t, std::size_t pos) { return pos; }
+};
+
+// transcode one code point through the functors,
+// nothing is consumed if it can not be decoded or encoded.
+template<typename T1, typename T2>
+inline bool transcode_one(const char*& ib, const char* ie, char*& ob, char* oe) {
+  if (ib >= ie || ob >= oe) {
+    return false;
+  }
+  uchar u;
+  int p = T1()(ib, clamp_len(ie - ib), u);
+  if (p < 0) {
+    return false;
+  }
+  int q = T2()(u, ob, clamp_len(oe - ob));
+  if (q < 0) {
+    return false;
+  }
+  ib += p;
+  ob += q;
+  return true;
+}
+
+// direct transcoders between two encodings, same contract as bulk.
+// the primary template goes through uchar one code point at a time, the utf pairs are specialized.
+template<typename T1, typename T2>
+struct scalar_transcode {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+template<typename T1, typename T2,
+         int B1 = utf_traits<T1>::bits, int B2 = utf_traits<T2>::bits>
+struct transcode: scalar_transcode<T1, T2> {};
+
+} // namespace detail
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  error policies
+///////////////////////////////////////////////////////////////////////////////
+
+// what encode, decode and convert do with input they can not handle,
+// picked at compile time by a template argument, the names follow python.
+//   strict            stop there and return the number of input elements left (default)
+//   raise             throw decode_error or encode_error with the offset
+//   replace           decode to U+FFFD, encode as '?'
+//   ignore            drop it
+//   surrogateescape   decode bytes 0x80-0xff to U+DC80-U+DCFF and encode them back
+// a policy only runs once the kernels have stopped, the loops over valid input stay the same.
+namespace errors {
+
+struct strict {};
+
+struct raise {};
+
+struct replace {
+  template<typename T>
+  static int bad_input(const char*, std::size_t, uchar* us) {
+    us[0] = uchar(0xfffdu);
+    return 1;
+  }
+
+  template<typename T>
+  static int bad_char(uchar, char* bs) {
+    return T()(uchar('?'), bs, 8);
+  }
+};
+
+struct ignore {
+  template<typename T>
+  static int bad_input(const char*, std::size_t, uchar*) { return 0; }
+
+  template<typename T>
+  static int bad_char(uchar, char*) { return 0; }
+};
+
+struct surrogateescape {
+  template<typename T>
+  static int bad_input(const char* bs, std::size_t n, uchar* us) {
+    for (std::size_t i = 0; i < n; ++i) {
+      std::uint32_t b = static_cast<std::uint8_t>(bs[i]);
+      if (b < 0x80) {
+        return -1;
+      }
+      us[i] = uchar(0xdc00u + b);
+    }
+    return static_cast<int>(n);
+  }
+
+  template<typename T>
+  static int bad_char(uchar u, char* bs) {
+    if (detail::utf_traits<T>::bits >= 16 || u.value() < 0xdc80 || u.value() > 0xdcff) {
+      return -1;
+    }
+    bs[0] = static_cast<char>(u.value() & 0xff);
+    return 1;
+  }
+};
+
+} // namespace errors
+
+namespace detail {
+
+// false for the policies that stop at the first error
+template<typename P>
+struct recovers: std::true_type {};
+template<>
+struct recovers<errors::strict>: std::false_type {};
+template<>
+struct recovers<errors::raise>: std::false_type {};
+
+template<typename P>
+struct raises: std::false_type {};
+template<>
+struct raises<errors::raise>: std::true_type {};
+
+// bytes of an invalid sequence at bb, handed to the policy as one error, at least one.
+// utf-8 takes the maximal subpart of a valid sequence, as python does.
+template<int B>
+struct bad_span {
+  static std::size_t len(const char*, const char*) { return 1; }
+};
+
+template<>
+struct bad_span<8> {
+  static std::size_t len(const char* bb, const char* be) {
+    std::uint8_t c = static_cast<std::uint8_t>(bb[0]);
+    if (c < 0xc2 || c > 0xf4) {
+      return 1;
+    }
+    std::size_t n = c >= 0xf0 ? 4 : c >= 0xe0 ? 3 : 2;
+    std::uint8_t lo = c == 0xe0 ? 0xa0 : c == 0xf0 ? 0x90 : 0x80;
+    std::uint8_t hi = c == 0xed ? 0x9f : c == 0xf4 ? 0x8f : 0xbf;
+    std::size_t i = 1;
+    for (; i < n && bb + i < be; ++i) {
+      std::uint8_t d = static_cast<std::uint8_t>(bb[i]);
+      if (d < lo || d > hi) {
+        break;
+      }
+      lo = 0x80;
+      hi = 0xbf;
+    }
+    return i;
+  }
+};
+
+template<>
+struct bad_span<16> {
+  static std::size_t len(const char* bb, const char* be) { return std::min<std::size_t>(2, be - bb); }
+};
+
+template<>
+struct bad_span<32> {
+  static std::size_t len(const char* bb, const char* be) { return std::min<std::size_t>(4, be - bb); }
+};
+
+// the cold paths, consume one error at the input and write what the policy puts there.
+// false if the policy stops or the output has no room, nothing is consumed then.
+// they run on a full output too, as long as the policy writes nothing.
+
+template<typename T, typename P>
+bool recover_decode(const char*& bb, const char* be, uchar*& sb, uchar* se) {
+  uchar u;
+  if (sb == se && T()(bb, clamp_len(be - bb), u) >= 0) {
+    return false;
+  }
+  std::size_t n = bad_span<utf_traits<T>::bits>::len(bb, be);
+  uchar t[8];
+  int k = P::template bad_input<T>(bb, n, t);
+  if (k < 0 || se - sb < k) {
+    return false;
+  }
+  sb = std::copy(t, t + k, sb);
+  bb += n;
+  return true;
+}
+
+template<typename T, typename P>
+bool recover_encode(const uchar*& sb, char*& bb, char* be) {
+  char t[8] = {};
+  if (T()(*sb, t, 8) >= 0) {
+    // it was the output that is full
+    return false;
+  }
+  int k = P::template bad_char<T>(*sb, t);
+  if (k < 0 || be - bb < k) {
+    return false;
+  }
+  bb = std::copy(t, t + k, bb);
+  ++sb;
+  return true;
+}
+
+template<typename T1, typename T2, typename P>
+bool recover_convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+  uchar u;
+  uchar us[8];
+  int k = 1;
+  std::size_t n = 0;
+  int p = T1()(ib, clamp_len(ie - ib), u);
+  if (p < 0) {
+    n = bad_span<utf_traits<T1>::bits>::len(ib, ie);
+    k = P::template bad_input<T1>(ib, n, us);
+    if (k < 0) {
+      return false;
+    }
+  } else {
+    n = p;
+    us[0] = u;
+  }
+  char t[32];
+  char *tb = t;
+  for (int i = 0; i < k; ++i) {
+    int q = T2()(us[i], tb, 8);
+    if (q < 0 && (q = P::template bad_char<T2>(us[i], tb)) < 0) {
+      return false;
+    }
+    tb += q;
+  }
+  if (oe - ob < tb - t) {
+    return false;
+  }
+  ob = std::copy(t, tb, ob);
+  ib += n;
+  return true;
+}
+
+// the kernels with a policy, same contract as bulk and transcode.
+// strict and raise are the plain kernels.
+
+template<typename T, typename P, bool = recovers<P>::value>
+struct checked: bulk<T> {};
+
+template<typename T, typename P>
+struct checked<T, P, true> {
+  static void decode(const char*& bb, const char* be, uchar*& sb, uchar* se) {
+    do {
+      bulk<T>::decode(bb, be, sb, se);
+    } while (bb < be && recover_decode<T, P>(bb, be, sb, se));
+  }
+
+  static void encode(const uchar*& sb, const uchar* se, char*& bb, char* be) {
+    do {
+      bulk<T>::encode(sb, se, bb, be);
+    } while (sb < se && recover_encode<T, P>(sb, bb, be));
+  }
+};
+
+template<typename T1, typename T2, typename P, bool = recovers<P>::value>
+struct checked_transcode: transcode<T1, T2> {};
+
+template<typename T1, typename T2, typename P>
+struct checked_transcode<T1, T2, P, true> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    do {
+      transcode<T1, T2>::convert(ib, ie, ob, oe);
+    } while (ib < ie && recover_convert<T1, T2, P>(ib, ie, ob, oe));
+  }
+};
+
+// for errors::raise, where the plain kernels stopped on an error and not on a full output
+
+template<typename T>
+void raise_decode(const char* bb, const char* be, std::size_t offset) {
+  uchar u;
+  if (T()(bb, clamp_len(be - bb), u) < 0) {
+    throw decode_error("minicode: can not decode", offset);
+  }
+}
+
+template<typename T>
+void raise_encode(const uchar* sb, std::size_t offset) {
+  char t[8];
+  if (T()(*sb, t, 8) < 0) {
+    throw encode_error("minicode: can not encode", offset);
+  }
+}
+
+template<typename T1, typename T2>
+void raise_convert(const char* ib, const char* ie, std::size_t offset) {
+  uchar u;
+  if (T1()(ib, clamp_len(ie - ib), u) < 0) {
+    throw decode_error("minicode: can not decode", offset);
+  }
+  char t[8];
+  if (T2()(u, t, 8) < 0) {
+    throw encode_error("minicode: can not encode", offset);
+  }
+}
+
+} // namespace detail
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  template functions for encode, decode and convert
+///////////////////////////////////////////////////////////////////////////////
+
+// tag to append the output to the destination instead of replacing it
+struct append_t {};
+constexpr append_t append{};
+
+// output lengths, as far as the input can be encoded, decoded or converted.
+// the utf encodings are counted without converting as long as the input is valid,
+// what is left and the other encodings run the same kernels into a small scratch buffer.
+
+namespace detail {
+
+// the counters, specialized in the bulk kernels of each encoding.
+// they stop at the first element that may not go through as it is, adding the output length before it to n.
+// the primary templates count nothing.
+
+template<typename T, int B = utf_traits<T>::bits>
+struct encoded_size {
+  static const uchar* run(const uchar* sb, const uchar*, std::size_t&) { return sb; }
+};
+
+// in code points
+template<typename T, int B = utf_traits<T>::bits>
+struct decoded_size {
+  static const char* run(const char* bb, const char*, std::size_t&) { return bb; }
+};
+
+template<typename T1, typename T2, int B1 = utf_traits<T1>::bits, int B2 = utf_traits<T2>::bits>
+struct converted_size {
+  static const char* run(const char* bb, const char*, std::size_t&) { return bb; }
+};
+
+// the input pointer is left where decoding or converting would stop
+
+template<typename T, typename P = errors::strict>
+std::size_t decode_length(const char*& bb, const char* be) {
+  uchar s[256];
+  std::size_t n = 0;
+  while (bb < be) {
+    bb = decoded_size<T>::run(bb, be, n);
+    if (bb == be) {
+      break;
+    }
+    const char *b0 = bb;
+    uchar *sb = s;
+    checked<T, P>::decode(bb, be, sb, s + 256);
+    if (bb == b0) {
+      break;
+    }
+    n += sb - s;
+  }
+  return n;
+}
+
+template<typename T1, typename T2, typename P = errors::strict>
+std::size_t convert_length(const char*& b1b, const char* b1e) {
+  char b[1024];
+  std::size_t n = 0;
+  while (b1b < b1e) {
+    b1b = converted_size<T1, T2>::run(b1b, b1e, n);
+    if (b1b == b1e) {
+      break;
+    }
+    const char *b0 = b1b;
+    char *bb = b;
+    checked_transcode<T1, T2, P>::convert(b1b, b1e, bb, b + sizeof(b));
+    if (b1b == b0) {
+      break;
+    }
+    n += bb - b;
+  }
+  return n;
+}
+
+template<typename T, typename P = errors::strict>
+std::size_t encode_length(const uchar*& sb, const uchar* se) {
+  char b[1024];
+  std::size_t n = 0;
+  while (sb < se) {
+    sb = encoded_size<T>::run(sb, se, n);
+    if (sb == se) {
+      break;
+    }
+    const uchar *s0 = sb;
+    char *bb = b;
+    checked<T, P>::encode(sb, se, bb, b + sizeof(b));
+    if (sb == s0) {
+      break;
+    }
+    n += bb - b;
+  }
+  return n;
+}
+
+} // namespace detail
+
+template<typename T, typename P = errors::strict>
+std::size_t encoded_length(str_view ss) {
+  const uchar *sb = ss.data();
+  return detail::encode_length<T, P>(sb, ss.limit());
+}
+
+template<typename T, typename P = errors::strict>
+std::size_t decoded_length(bytes_view bs) {
+  const char *bb = bs.data();
+  return detail::decode_length<T, P>(bb, bs.limit());
+}
+
+template<typename T1, typename T2, typename P = errors::strict>
+std::size_t converted_length(bytes_view b1) {
+  const char *b1b = b1.data();
+  return detail::convert_length<T1, T2, P>(b1b, b1.limit());
+}
+
+// write into a caller-provided buffer of n elements,
+// m is set to the number of elements written.
+// return the number of input elements left, as the other overloads do.
+// with errors::raise they throw where the others would stop on an error,
+// what comes before it is written.
+
+template<typename T, typename P = errors::strict>
+int encode(str_view ss, char* bs, std::size_t n, std::size_t& m) {
+  const uchar *sb = ss.data();
+  const uchar *se = ss.limit();
+  char *bb = bs;
+  detail::checked<T, P>::encode(sb, se, bb, bs + n);
+  m = bb - bs;
+  if (detail::raises<P>::value && sb < se) {
+    detail::raise_encode<T>(sb, sb - ss.data());
+  }
+  return se - sb;
+}
+
+template<typename T, typename P = errors::strict>
+int decode(bytes_view bs, uchar* ss, std::size_t n, std::size_t& m) {
+  const char *bb = bs.data();
+  const char *be = bs.limit();
+  uchar *sb = ss;
+  detail::checked<T, P>::decode(bb, be, sb, ss + n);
+  m = sb - ss;
+  if (detail::raises<P>::value && bb < be) {
+    detail::raise_decode<T>(bb, be, bb - bs.data());
+  }
+  return be - bb;
+}
+
+template<typename T1, typename T2, typename P = errors::strict>
+int convert(bytes_view b1, char* b2, std::size_t n, std::size_t& m) {
+  const char *b1b = b1.data();
+  const char *b1e = b1.limit();
+  char *bb = b2;
+  detail::checked_transcode<T1, T2, P>::convert(b1b, b1e, bb, b2 + n);
+  m = bb - b2;
+  if (detail::raises<P>::value && b1b < b1e) {
+    detail::raise_convert<T1, T2>(b1b, b1e, b1b - b1.data());
+  }
+  return b1e - b1b;
+}
+
+// append to the destination, sized exactly once.
+// the destination may use any allocator, an arena_allocator keeps a batch off the heap.
+
+template<typename T, typename P = errors::strict, typename A>
+int encode(str_view ss, sequence<char, A>& bs, append_t) {
+  std::size_t k = bs.size();
+  bs.resize(k + encoded_length<T, P>(ss));
+  std::size_t m = 0;
+  return encode<T, P>(ss, bs.data() + k, bs.size() - k, m);
+}
+
+template<typename T, typename P = errors::strict, typename A>
+int decode(bytes_view bs, sequence<uchar, A>& ss, append_t) {
+  std::size_t k = ss.size();
+  ss.resize(k + decoded_length<T, P>(bs));
+  std::size_t m = 0;
+  return decode<T, P>(bs, ss.data() + k, ss.size() - k, m);
+}
+
+template<typename T1, typename T2, typename P = errors::strict, typename A>
+int convert(bytes_view b1, sequence<char, A>& b2, append_t) {
+  if (detail::overlaps(b1.data(), b1.limit(), b2.data(), b2.limit())) {
+    bytes b(b1);
+    return convert<T1, T2, P>(b, b2, append);
+  }
+  std::size_t k = b2.size();
+  b2.resize(k + converted_length<T1, T2, P>(b1));
+  std::size_t m = 0;
+  return convert<T1, T2, P>(b1, b2.data() + k, b2.size() - k, m);
+}
+
+template<typename T, typename P = errors::strict, typename A>
+int encode(str_view ss, sequence<char, A>& bs) {
+  bs.clear();
+  return encode<T, P>(ss, bs, append);
+}
+
+template<typename T, typename P = errors::strict, typename A>
+int decode(bytes_view bs, sequence<uchar, A>& ss) {
+  ss.clear();
+  return decode<T, P>(bs, ss, append);
+}
+
+template<typename T1, typename T2, typename P = errors::strict, typename A>
+int convert(bytes_view b1, sequence<char, A>& b2) {
+  if (detail::overlaps(b1.data(), b1.limit(), b2.data(), b2.limit())) {
+    bytes b(b1);
+    return convert<T1, T2, P>(b, b2);
+  }
+  b2.clear();
+  return convert<T1, T2, P>(b1, b2, append);
+}
+
+// the same into a std::string or std::vector<char>, written in place without a copy
+
+namespace detail {
+
+template<typename C>
+struct is_char_buffer: std::false_type {};
+
+template<typename Tr, typename A>
+struct is_char_buffer<std::basic_string<char, Tr, A>>: std::true_type {};
+
+template<typename A>
+struct is_char_buffer<std::vector<char, A>>: std::true_type {};
+
+template<typename C>
+const char* buffer_data(const C& c) {
+  return c.empty() ? nullptr : &c[0];
+}
+
+// resize c by n and return where the new elements start
+template<typename C>
+char* grow(C& c, std::size_t n) {
+  std::size_t k = c.size();
+  c.resize(k + n);
+  return n > 0 ? &c[k] : nullptr;
+}
+
+} // namespace detail
+
+template<typename T, typename P = errors::strict, typename C>
+typename std::enable_if<detail::is_char_buffer<C>::value, int>::type
+encode(str_view ss, C& bs, append_t) {
+  std::size_t n = encoded_length<T, P>(ss);
+  std::size_t m = 0;
+  return encode<T, P>(ss, detail::grow(bs, n), n, m);
+}
+
+template<typename T1, typename T2, typename P = errors::strict, typename C>
+typename std::enable_if<detail::is_char_buffer<C>::value, int>::type
+convert(bytes_view b1, C& b2, append_t) {
+  if (detail::overlaps(b1.data(), b1.limit(), detail::buffer_data(b2), detail::buffer_data(b2) + b2.size())) {
+    bytes b(b1);
+    return convert<T1, T2, P>(b, b2, append);
+  }
+  std::size_t n = converted_length<T1, T2, P>(b1);
+  std::size_t m = 0;
+  return convert<T1, T2, P>(b1, detail::grow(b2, n), n, m);
+}
+
+template<typename T, typename P = errors::strict, typename C>
+typename std::enable_if<detail::is_char_buffer<C>::value, int>::type
+encode(str_view ss, C& bs) {
+  bs.clear();
+  return encode<T, P>(ss, bs, append);
+}
+
+template<typename T1, typename T2, typename P = errors::strict, typename C>
+typename std::enable_if<detail::is_char_buffer<C>::value, int>::type
+convert(bytes_view b1, C& b2) {
+  if (detail::overlaps(b1.data(), b1.limit(), detail::buffer_data(b2), detail::buffer_data(b2) + b2.size())) {
+    bytes b(b1);
+    return convert<T1, T2, P>(b, b2);
+  }
+  b2.clear();
+  return convert<T1, T2, P>(b1, b2, append);
+}
+
+inline std::string to_string(bytes_view bs) {
+  return std::string(bs.data(), bs.size());
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  validation and counting
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// where decoding would stop on [bb, be), adding the code points before it to n.
+// the primary template decodes into a scratch buffer, the encodings with a cheaper test are specialized.
+template<typename T, int B = utf_traits<T>::bits>
+struct scan {
+  static const char* run(const char* bb, const char* be, std::size_t& n) {
+    n += decode_length<T>(bb, be);
+    return bb;
+  }
+};
+
+} // namespace detail
+
+// none of them allocate. utf-8 is checked as the standard defines it,
+// stricter than decode<utf8>, which also takes overlong forms and surrogates.
+
+// offset of the first byte that is not valid T, bs.size() if there is none.
+// for utf8 that is the first byte that is not valid utf-8, which can come before
+// the place decode<utf8> stops: an overlong form or a surrogate ends it here, not there.
+template<typename T>
+std::size_t first_error(bytes_view bs) {
+  std::size_t n = 0;
+  return detail::scan<T>::run(bs.data(), bs.limit(), n) - bs.data();
+}
+
+template<typename T>
+bool validate(bytes_view bs) {
+  return first_error<T>(bs) == bs.size();
+}
+
+template<typename T>
+bool validate(const char* bs, std::size_t n) {
+  return validate<T>(bytes_view(bs, n));
+}
+
+// code points up to the first error
+template<typename T>
+std::size_t count_codepoints(bytes_view bs) {
+  std::size_t n = 0;
+  detail::scan<T>::run(bs.data(), bs.limit(), n);
+  return n;
+}
+
+template<typename T>
+std::size_t count_codepoints(const char* bs, std::size_t n) {
+  return count_codepoints<T>(bytes_view(bs, n));
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  decoded view
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// start of the code point that ends at p, for walking backwards.
+// only the encodings that can find it without looking further back are specialized.
+template<typename T, int B = utf_traits<T>::bits>
+struct step_back;
+
+// true if step_back has a specialization for T
+template<typename T>
+struct has_step_back: std::integral_constant<bool, utf_traits<T>::bits == 1 || utf_traits<T>::bits == 8 ||
+                                                   utf_traits<T>::bits == 16 || utf_traits<T>::bits == 32> {};
+
+} // namespace detail
+
+// the code points of encoded bytes, decoded as they are visited.
+// the range ends at the first sequence that can not be decoded, where base() of the iterator points.
+// the iterators are bidirectional for the utf and single byte encodings, forward for the others;
+// walking back from end() decodes from the end of the input, so it meets the forward walk on valid input only.
+// the view refers to the bytes, they must outlive it.
+template<typename T>
+class decoded_view {
+public:
+  class iterator {
+  public:
+    typedef typename std::conditional<detail::has_step_back<T>::value,
+        std::bidirectional_iterator_tag, std::forward_iterator_tag>::type iterator_category;
+    typedef uchar value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const uchar* pointer;
+    typedef const uchar& reference;
+
+    iterator():_b(nullptr),_e(nullptr),_p(nullptr),_u(0u),_n(0){}
+
+    reference operator*() const { return _u; }
+    pointer operator->() const { return &_u; }
+
+    iterator& operator++() {
+      _p += _n;
+      _read();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator r(*this);
+      ++*this;
+      return r;
+    }
+
+    iterator& operator--() {
+      if (_p > _b) {
+        _p = detail::step_back<T>::prev(_b, _p);
+        _read();
+      }
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator r(*this);
+      --*this;
+      return r;
+    }
+
+    // every position where no code point can be decoded is the end
+    bool operator==(const iterator& it) const { return _p == it._p || (_n <= 0 && it._n <= 0); }
+    bool operator!=(const iterator& it) const { return !(*this == it); }
+
+    // the encoded bytes of the current code point start here
+    const char* base() const { return _p; }
+
+  private:
+    friend class decoded_view;
+
+    iterator(const char* b, const char* e, const char* p):_b(b),_e(e),_p(p),_u(0u),_n(0) { _read(); }
+
+    void _read() {
+      if (_p >= _e) {
+        _n = 0;
+        return;
+      }
+      // ascii takes one byte in the encodings that keep it as it is
+      if (detail::utf_traits<T>::bits <= 8 && detail::utf_traits<T>::bits > 0 &&
+          static_cast<std::uint8_t>(*_p) < 0x80) {
+        _u = uchar(*_p);
+        _n = 1;
+        return;
+      }
+      _n = T()(_p, detail::clamp_len(_e - _p), _u);
+    }
+
+    const char *_b;
+    const char *_e;
+    const char *_p;
+    uchar _u;
+    int _n;
+  };
+
+  typedef iterator const_iterator;
+
+  decoded_view() = default;
+  explicit decoded_view(bytes_view bs):_bs(bs){}
+
+  iterator begin() const { return iterator(_bs.data(), _bs.limit(), _bs.data()); }
+  iterator end() const { return iterator(_bs.data(), _bs.limit(), _bs.limit()); }
+
+  bool empty() const { return begin() == end(); }
+  bytes_view as_bytes() const { return _bs; }
+
+private:
+  bytes_view _bs;
+};
+
+// output iterator that encodes the code points assigned to it at the end of bs,
+// a bytes, std::string or std::vector<char>.
+// they are gathered in blocks for the bulk encoder: the bytes reach bs when a block is full,
+// on flush() or good(), and when the last copy of the iterator goes away.
+// call flush() before reading bs, up to 255 code points are missing from it until then.
+// the last copy can not throw, a failure to write there is only recorded in good.
+// a code point the policy can not handle stops it, good() tells if that happened.
+// with errors::raise the code point throws as it is assigned.
+template<typename T, typename P = errors::strict, typename C = bytes>
+class encoded_inserter {
+public:
+  typedef std::output_iterator_tag iterator_category;
+  typedef void value_type;
+  typedef void difference_type;
+  typedef void pointer;
+  typedef void reference;
+
+  explicit encoded_inserter(C& bs):_state(std::make_shared<state>(bs)){}
+
+  encoded_inserter& operator=(const uchar& u) {
+    state& st = *_state;
+    if (!st.good) {
+      return *this;
+    }
+    if (detail::raises<P>::value) {
+      char t[8];
+      const uchar *sb = &u;
+      char *tb = t;
+      detail::checked<T, P>::encode(sb, &u + 1, tb, t + 8);
+      if (sb == &u) {
+        st.flush();
+        detail::raise_encode<T>(&u, st.count);
+      }
+    }
+    st.buff[st.n++] = u;
+    ++st.count;
+    if (st.n == block) {
+      st.flush();
+    }
+    return *this;
+  }
+
+  encoded_inserter& operator*() { return *this; }
+  encoded_inserter& operator++() { return *this; }
+  encoded_inserter& operator++(int) { return *this; }
+
+  // write out the code points gathered so far
+  void flush() { _state->flush(); }
+
+  bool good() const {
+    _state->flush();
+    return _state->good;
+  }
+
+private:
+  static const int block = 256;
+
+  // shared by the copies, output iterators are passed by value
+  struct state {
+    C *bs;
+    uchar buff[block];
+    int n;
+    std::size_t count;
+    bool good;
+
+    explicit state(C& b):bs(&b),n(0),count(0),good(true){}
+    state(const state&) = delete;
+    state& operator=(const state&) = delete;
+    ~state() {
+      try {
+        flush();
+      } catch (...) {
+        good = false;
+      }
+    }
+
+    // raise checked every code point already, the strict encoder does not throw
+    void flush() {
+      typedef typename std::conditional<detail::raises<P>::value, errors::strict, P>::type policy;
+      if (n > 0) {
+        good = encode<T, policy>(str_view(buff, n), *bs, append) == 0 && good;
+        n = 0;
+      }
+    }
+  };
+
+  std::shared_ptr<state> _state;
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  compact str
+///////////////////////////////////////////////////////////////////////////////
+
+// pep 393 like string: every code point takes 1 (latin-1), 2 (ucs-2) or 4 (ucs-4) bytes,
+// the narrowest width that fits the widest one. indexing stays O(1).
+class compact_str {
+public:
+  class const_iterator {
+  public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef uchar value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const uchar* pointer;
+    typedef uchar reference;
+
+    const_iterator():_s(nullptr),_i(0){}
+    const_iterator(const compact_str* s, std::size_t i):_s(s),_i(i){}
+
+    uchar operator*() const { return uchar(_s->_at(_i)); }
+    uchar operator[](difference_type n) const { return uchar(_s->_at(_i + n)); }
+    const_iterator& operator++() { ++_i; return *this; }
+    const_iterator operator++(int) { const_iterator t(*this); ++_i; return t; }
+    const_iterator& operator--() { --_i; return *this; }
+    const_iterator operator--(int) { const_iterator t(*this); --_i; return t; }
+    const_iterator& operator+=(difference_type n) { _i += n; return *this; }
+    const_iterator& operator-=(difference_type n) { _i -= n; return *this; }
+    const_iterator operator+(difference_type n) const { return const_iterator(_s, _i + n); }
+    const_iterator operator-(difference_type n) const { return const_iterator(_s, _i - n); }
+    difference_type operator-(const const_iterator& o) const { return _i - o._i; }
+    bool operator==(const const_iterator& o) const { return _i == o._i; }
+    bool operator!=(const const_iterator& o) const { return _i != o._i; }
+    bool operator<(const const_iterator& o) const { return _i < o._i; }
+    bool operator>(const const_iterator& o) const { return _i > o._i; }
+    bool operator<=(const const_iterator& o) const { return _i <= o._i; }
+    bool operator>=(const const_iterator& o) const { return _i >= o._i; }
+
+  private:
+    const compact_str* _s;
+    std::size_t _i;
+  };
+
+  compact_str():_size(0),_width(1){}
+  compact_str(const compact_str&) = default;
+  compact_str(compact_str&&) = default;
+  compact_str& operator=(const compact_str&) = default;
+  compact_str& operator=(compact_str&&) = default;
+
+  explicit compact_str(str_view s):_size(0),_width(1) { assign(s.data(), s.limit()); }
+
+  static int width_of(std::uint32_t u) { return u < 0x100 ? 1 : (u < 0x10000 ? 2 : 4); }
+
+  void assign(const uchar* b, const uchar* e) {
+    reset(e - b, width_of(detail::or_all(b, e - b)));
+    put(0, b, e - b);
+  }
+
+  // n units of width w, to be filled with put
+  void reset(std::size_t n, int w) {
+    _size = n;
+    _width = w;
+    _data.assign((n * w + 3) / 4, 0);
+  }
+
+  // store n code points at i, they must fit the width
+  void put(std::size_t i, const uchar* s, std::size_t n) {
+    if (_width == 1) {
+      detail::narrow(s, n, latin1() + i);
+    } else if (_width == 2) {
+      detail::narrow(s, n, ucs2() + i);
+    } else {
+      detail::narrow(s, n, ucs4() + i);
+    }
+  }
+
+  // load n code points from i
+  void get(std::size_t i, uchar* s, std::size_t n) const {
+    if (_width == 1) {
+      detail::widen(latin1() + i, n, s);
+    } else if (_width == 2) {
+      detail::widen(ucs2() + i, n, s);
+    } else {
+      detail::widen(ucs4() + i, n, s);
+    }
+  }
+
+  bool operator==(const compact_str& s) const { return _size == s._size && _width == s._width && _data == s._data; }
+  bool operator!=(const compact_str& s) const { return !(*this == s); }
+
+  uchar operator[](int idx) const { return uchar(_at(_real_index(idx))); }
+
+  std::size_t size() const { return _size; }
+  int width() const { return _width; }
+
+  // raw units of the matching width
+  const std::uint8_t* latin1() const { return reinterpret_cast<const std::uint8_t*>(_data.data()); }
+  const std::uint16_t* ucs2() const { return reinterpret_cast<const std::uint16_t*>(_data.data()); }
+  const std::uint32_t* ucs4() const { return _data.data(); }
+  std::uint8_t* latin1() { return reinterpret_cast<std::uint8_t*>(_data.data()); }
+  std::uint16_t* ucs2() { return reinterpret_cast<std::uint16_t*>(_data.data()); }
+  std::uint32_t* ucs4() { return _data.data(); }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, _size); }
+
+  // the same element search as str, on the units of the width
+  int find(const uchar value, int start, int stop) const {
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    std::uint32_t u = value.value();
+    if (start >= stop || width_of(u) > _width) {
+      return -1;
+    }
+    return _found(_find(u, start, stop), stop);
+  }
+
+  int find(const uchar value, int start) const { return find(value, start, size()); }
+  int find(const uchar value) const { return find(value, 0, size()); }
+
+  int rfind(const uchar value, int start, int stop) const {
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    std::uint32_t u = value.value();
+    if (start >= stop || width_of(u) > _width) {
+      return -1;
+    }
+    return _found(_rfind(u, start, stop), stop);
+  }
+
+  int rfind(const uchar value, int start) const { return rfind(value, start, size()); }
+  int rfind(const uchar value) const { return rfind(value, 0, size()); }
+
+  // the slice gets the narrowest width for its own contents
+  compact_str subrange(int start, int stop) const {
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    compact_str r;
+    if (start < stop) {
+      str s(stop - start);
+      get(start, s.data(), s.size());
+      r.assign(s.data(), s.limit());
+    }
+    return r;
+  }
+
+  str to_str() const {
+    str s(_size);
+    get(0, s.data(), _size);
+    return s;
+  }
+
+private:
+  std::uint32_t _at(std::size_t i) const {
+    return _width == 1 ? latin1()[i] : (_width == 2 ? ucs2()[i] : ucs4()[i]);
+  }
+
+  // index of u in [start, stop), stop if none
+  int _find(std::uint32_t u, int start, int stop) const {
+    if (_width == 1) {
+      const char *b = reinterpret_cast<const char*>(latin1());
+      return detail::find_elem(b + start, b + stop, static_cast<char>(u)) - b;
+    } else if (_width == 2) {
+      return detail::find_elem(ucs2() + start, ucs2() + stop, static_cast<std::uint16_t>(u)) - ucs2();
+    } else {
+      return detail::find_elem(ucs4() + start, ucs4() + stop, u) - ucs4();
+    }
+  }
+
+  int _rfind(std::uint32_t u, int start, int stop) const {
+    if (_width == 1) {
+      const char *b = reinterpret_cast<const char*>(latin1());
+      return detail::rfind_elem(b + start, b + stop, static_cast<char>(u)) - b;
+    } else if (_width == 2) {
+      return detail::rfind_elem(ucs2() + start, ucs2() + stop, static_cast<std::uint16_t>(u)) - ucs2();
+    } else {
+      return detail::rfind_elem(ucs4() + start, ucs4() + stop, u) - ucs4();
+    }
+  }
+
+  static int _found(int i, int stop) { return i == stop ? -1 : i; }
+
+  int _real_index(int idx) const { return idx < 0 ? idx + (int)size() : idx; }
+  int _clamp_index(int idx) const {
+    idx = _real_index(idx);
+    return idx < 0 ? 0 : (idx > (int)size() ? (int)size() : idx);
+  }
+
+private:
+  std::vector<std::uint32_t> _data;
+  std::size_t _size;
+  int _width;
+};
+
+// decode twice: the first pass finds the length and the width,
+// the second one stores the code points, so no 4-byte copy of the text is kept.
+template<typename T>
+int decode(bytes_view bs, compact_str& cs) {
+  uchar s[256];
+  const char *bb = bs.data();
+  const char *be = bs.limit();
+  std::size_t n = 0;
+  std::uint32_t u = 0;
+  while (bb < be) {
+    uchar *sb = s;
+    detail::bulk<T>::decode(bb, be, sb, s + 256);
+    if (sb == s) {
+      break;
+    }
+    n += sb - s;
+    u |= detail::or_all(s, sb - s);
+  }
+  cs.reset(n, compact_str::width_of(u));
+  bb = bs.data();
+  for (std::size_t i = 0; i < n; ) {
+    uchar *sb = s;
+    detail::bulk<T>::decode(bb, be, sb, s + std::min<std::size_t>(256, n - i));
+    cs.put(i, s, sb - s);
+    i += sb - s;
+  }
+  return be - bb;
+}
+
+template<typename T>
+int encode(const compact_str& cs, bytes& bs) {
+  if (detail::utf_traits<T>::bits == 8 && cs.width() == 1) {
+    // latin-1 to utf-8, every byte from 0x80 takes two
+    const std::uint8_t *ib = cs.latin1();
+    const std::uint8_t *ie = ib + cs.size();
+    std::size_t n = cs.size();
+    for (const std::uint8_t *p = ib; p < ie; ++p) {
+      n += *p >> 7;
+    }
+    bs.clear();
+    bs.resize(n);
+    char *ob = bs.data();
+    detail::latin1_to_utf8(ib, ie, ob, ob + n);
+    return 0;
+  }
+  // other widths and encodings go through the bulk encoder, 256 code points at a time
+  uchar s[256];
+  std::size_t n = 0;
+  std::size_t i = 0;
+  bool stop = false;
+  for (; i < cs.size() && !stop; i += 256) {
+    std::size_t m = std::min<std::size_t>(256, cs.size() - i);
+    cs.get(i, s, m);
+    const uchar *sb = s;
+    while (sb < s + m) {
+      char b[1024];
+      char *bb = b;
+      detail::bulk<T>::encode(sb, s + m, bb, b + sizeof(b));
+      if (bb == b) {
+        stop = true;
+        break;
+      }
+      n += bb - b;
+    }
+  }
+  bs.clear();
+  bs.resize(n);
+  char *ob = bs.data();
+  char *oe = ob + n;
+  for (i = 0; i < cs.size(); i += 256) {
+    std::size_t m = std::min<std::size_t>(256, cs.size() - i);
+    cs.get(i, s, m);
+    const uchar *sb = s;
+    detail::bulk<T>::encode(sb, s + m, ob, oe);
+    if (sb != s + m) {
+      return cs.size() - i - (sb - s);
+    }
+  }
+  return 0;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  parallel decode and convert
+///////////////////////////////////////////////////////////////////////////////
+
+// split big inputs into chunks decoded or converted on their own thread.
+// threads 0 means one per hardware thread, chunks are at least min_chunk bytes.
+struct parallel_policy {
+  explicit parallel_policy(unsigned threads = 0, std::size_t min_chunk = 1 << 20)
+    :threads(threads),min_chunk(min_chunk){}
+
+  unsigned threads;
+  std::size_t min_chunk;
+};
+
+namespace detail {
+
+// run f(0) to f(n - 1), f(0) on the calling thread.
+// if starting a thread or f(0) throws, the threads already started are joined before it goes on.
+template<typename F>
+void parallel_for(std::size_t n, F f) {
+  std::vector<std::thread> ts;
+  try {
+    ts.reserve(n > 0 ? n - 1 : 0);
+    for (std::size_t i = 1; i < n; ++i) {
+      ts.emplace_back(f, i);
+    }
+    f(0);
+  } catch (...) {
+    for (std::size_t i = 0; i < ts.size(); ++i) {
+      ts[i].join();
+    }
+    throw;
+  }
+  for (std::size_t i = 0; i < ts.size(); ++i) {
+    ts[i].join();
+  }
+}
+
+// chunk offsets of bs, from 0 to bs.size(), each one a code point boundary
+template<typename T>
+std::vector<std::size_t> split_points(bytes_view bs, const parallel_policy& pp) {
+  std::size_t n = bs.size();
+  std::size_t k = pp.threads > 0 ? pp.threads : std::thread::hardware_concurrency();
+  k = std::min(k, n / std::max<std::size_t>(pp.min_chunk, 1));
+  std::vector<std::size_t> cuts(1, 0);
+  if (boundary<T>::splittable) {
+    for (std::size_t i = 1; i < k; ++i) {
+      std::size_t pos = boundary<T>::next(bs.data(), n, n / k * i);
+      if (pos > cuts.back() && pos < n) {
+        cuts.push_back(pos);
+      }
+    }
+  }
+  cuts.push_back(n);
+  return cuts;
+}
+
+} // namespace detail
+
+// same output and return value as the serial overloads,
+// chunk sizes are measured first, so the output is allocated exactly once.
+
+template<typename T>
+int decode(bytes_view bs, str& ss, const parallel_policy& pp) {
+  std::vector<std::size_t> cuts = detail::split_points<T>(bs, pp);
+  std::size_t k = cuts.size() - 1;
+  if (k < 2) {
+    return decode<T>(bs, ss);
+  }
+  std::vector<std::size_t> len(k + 1, 0), stop(k);
+  detail::parallel_for(k, [&](std::size_t i) {
+    const char *bb = bs.data() + cuts[i];
+    len[i + 1] = detail::decode_length<T>(bb, bs.data() + cuts[i + 1]);
+    stop[i] = bb - bs.data();
+  });
+  // nothing after the first chunk that stops early
+  std::size_t used = 1;
+  while (used < k && stop[used - 1] == cuts[used]) {
+    ++used;
+  }
+  for (std::size_t i = 0; i < used; ++i) {
+    len[i + 1] += len[i];
+  }
+  ss.clear();
+  ss.resize(len[used]);
+  detail::parallel_for(used, [&](std::size_t i) {
+    const char *bb = bs.data() + cuts[i];
+    uchar *sb = ss.data() + len[i];
+    detail::bulk<T>::decode(bb, bs.data() + stop[i], sb, ss.data() + len[i + 1]);
+  });
+  return bs.size() - stop[used - 1];
+}
+
+template<typename T1, typename T2>
+int convert(bytes_view b1, bytes& b2, const parallel_policy& pp) {
+  if (detail::overlaps(b1.data(), b1.limit(), b2.data(), b2.limit())) {
+    bytes b(b1);
+    return convert<T1, T2>(b, b2, pp);
+  }
+  std::vector<std::size_t> cuts = detail::split_points<T1>(b1, pp);
+  std::size_t k = cuts.size() - 1;
+  if (k < 2) {
+    return convert<T1, T2>(b1, b2);
+  }
+  std::vector<std::size_t> len(k + 1, 0), stop(k);
+  detail::parallel_for(k, [&](std::size_t i) {
+    const char *ib = b1.data() + cuts[i];
+    len[i + 1] = detail::convert_length<T1, T2>(ib, b1.data() + cuts[i + 1]);
+    stop[i] = ib - b1.data();
+  });
+  std::size_t used = 1;
+  while (used < k && stop[used - 1] == cuts[used]) {
+    ++used;
+  }
+  for (std::size_t i = 0; i < used; ++i) {
+    len[i + 1] += len[i];
+  }
+  b2.clear();
+  b2.resize(len[used]);
+  detail::parallel_for(used, [&](std::size_t i) {
+    const char *ib = b1.data() + cuts[i];
+    char *ob = b2.data() + len[i];
+    detail::transcode<T1, T2>::convert(ib, b1.data() + stop[i], ob, b2.data() + len[i + 1]);
+  });
+  return b1.size() - stop[used - 1];
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  stream
+///////////////////////////////////////////////////////////////////////////////
+
+// decode a byte stream fed in chunks of any size.
+// consumed bytes are dropped lazily, so add_bytes is amortized O(chunk),
+// and a sequence split between chunks waits for the rest of its bytes.
+template<typename Encoding>
+class stream {
+public:
+  stream():_pos(0),_state(0){}
+  stream(const stream&) = default;
+  stream(stream&&) = default;
+  stream& operator=(const stream&) = default;
+  stream& operator=(stream&&) = default;
+
+  stream(const std::vector<char>& data):_data(data),_pos(0),_state(0){}
+  stream(std::vector<char>&& data):_data(std::move(data)),_pos(0),_state(0){}
+  stream(const char *data, std::size_t n):_data(data, data + n),_pos(0),_state(0){}
+  stream(bytes_view data):_data(data.data(), data.limit()),_pos(0),_state(0){}
+
+  stream& add_bytes(const std::vector<char>& data) {
+    return add_bytes(data.data(), data.size());
+  }
+
+  stream& add_bytes(bytes_view data) {
+    return add_bytes(data.data(), data.size());
+  }
+
+  // a drained stream takes over the memory of data
+  stream& add_bytes(std::vector<char>&& data) {
+    if (_pos < _data.size() || data.empty()) {
+      return add_bytes(data.data(), data.size());
+    }
+    _data = std::move(data);
+    _pos = 0;
+    _state &= ~1;
+    return *this;
+  }
+
+  stream& add_bytes(const char *data, std::uint32_t n) {
+    if (n == 0) {
+      return *this;
+    }
+    _compact();
+    _data.insert(_data.end(), data, data + n);
+    _state &= ~1;
+    return *this;
+  }
+
+  void clear() { _data.clear(); _pos = 0; _state = 0; }
+  int available() const { return _data.size() - _pos; }
+
+  bool get(uchar& uc) {
+    if (!good()) {
+      return false;
+    }
+    int p = _decode(uc);
+    if (p <= 0) {
+      return false;
+    }
+    _pos += p;
+    _check_eof();
+    return true;
+  }
+
+  bool peek(uchar& uc) const {
+    if (!good()) {
+      return false;
+    }
+    return _decode(uc) > 0;
+  }
+
+  // bulk reads drain as many complete code points as are buffered,
+  // an incomplete sequence at the end stays for the next add_bytes.
+
+  // read at most n code points into us, return the number read
+  std::size_t read(uchar* us, std::size_t n) {
+    if (!good()) {
+      return 0;
+    }
+    return _drain(us, us + n) - us;
+  }
+
+  // append everything available to ss, return the number read
+  std::size_t read_into(str& ss) {
+    if (!good()) {
+      return 0;
+    }
+    std::size_t k = ss.size();
+    ss.resize(k + available()); // at least one byte per code point
+    uchar *sb = _drain(ss.data() + k, ss.data() + ss.size());
+    ss.resize(sb - ss.data());
+    return ss.size() - k;
+  }
+
+  // append to ss up to and including delim, return true if delim was found
+  bool read_until(uchar delim, str& ss) {
+    uchar s[256];
+    while (good()) {
+      std::size_t pos = _pos;
+      int state = _state;
+      uchar *sb = _drain(s, s + 256);
+      int n = sb - s;
+      int i = str_view(s, n).find(delim);
+      if (i >= 0) {
+        // decode the block again, only up to delim
+        _pos = pos;
+        _state = state;
+        _drain(s, s + i + 1);
+        std::size_t k = ss.size();
+        ss.resize(k + i + 1);
+        std::copy(s, s + i + 1, ss.data() + k);
+        return true;
+      }
+      std::size_t k = ss.size();
+      ss.resize(k + n);
+      std::copy(s, sb, ss.data() + k);
+      if (n < 256) {
+        break;
+      }
+    }
+    return false;
+  }
+
+  bool good() const { return _state == 0; }
+  bool eof() const { return (_state & 1) != 0; }
+  bool bad() const { return (_state & 2) != 0; }
+
+private:
+  void _check_eof() {
+    if (available() == 0) {
+      _state |= 1;
+    }
+  }
+
+  // decode one code point at _pos, 0 if it needs more bytes.
+  // an invalid sequence makes the stream bad.
+  int _decode(uchar& uc) const {
+    Encoding enc;
+    const char *b = _data.data() + _pos;
+    int n = available();
+    int p = n > 0 ? enc(b, n, uc) : -1;
+    if (p < 0) {
+      if (n == 0 || detail::partial<Encoding>::test(b, n)) {
+        return 0;
+      }
+      _state |= 2;
+    }
+    return p;
+  }
+
+  // bulk decode into [sb, se), return where it stopped
+  uchar* _drain(uchar* sb, uchar* se) {
+    const char *bb = _data.data() + _pos;
+    const char *be = _data.data() + _data.size();
+    detail::bulk<Encoding>::decode(bb, be, sb, se);
+    _pos = bb - _data.data();
+    if (sb < se && bb < be && !detail::partial<Encoding>::test(bb, be - bb)) {
+      _state |= 2;
+    }
+    _check_eof();
+    return sb;
+  }
+
+  // drop the consumed bytes once they are at least half of the buffer, otherwise let it grow.
+  // the bytes moved are never more than the ones consumed since the last time,
+  // so the cost does not depend on how far the reader lags behind.
+  void _compact() {
+    if (_pos > 0 && _pos >= _data.size() / 2) {
+      _data.erase(_data.begin(), _data.begin() + _pos);
+      _pos = 0;
+    }
+  }
+
+private:
+  std::vector<char> _data;
+  std::size_t _pos;
+  mutable int _state;
+};
+
+
+namespace detail {
+
+// the conversion of transcoder<T1, T2>
+template<typename T1, typename T2>
+struct static_conv {
+  void convert(const char*& ib, const char* ie, char*& ob, char* oe) const {
+    transcode<T1, T2>::convert(ib, ie, ob, oe);
+  }
+  bool partial(const char* bs, std::size_t n) const { return detail::partial<T1>::test(bs, n); }
+};
+
+} // namespace detail
+
+// convert a byte stream fed in chunks of any size.
+// a code point split between chunks is carried over,
+// the output goes to a caller-provided buffer, or to a sink through a fixed buffer.
+// Conv provides convert(ib, ie, ob, oe) and partial(bs, n).
+template<typename Conv>
+class basic_transcoder {
+public:
+  typedef std::function<void(const char*, std::size_t)> sink_type;
+
+  explicit basic_transcoder(Conv conv)
+    :_conv(conv),_nout(0),_ncarry(0),_offset(0),_bad(false){}
+  basic_transcoder(Conv conv, sink_type sink, std::size_t n)
+    :_conv(conv),_sink(sink),_out(n < 16 ? 16 : n),_nout(0),_ncarry(0),_offset(0),_bad(false){}
+
+  // convert [ib, ie) into [ob, oe), advancing both.
+  // stop when the input is used up, keeping an incomplete tail, or when the output is full.
+  // return false on invalid input, offset() is then the position of the bad sequence.
+  bool convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    if (_bad) {
+      return false;
+    }
+    while (_ncarry > 0 && ib < ie) {
+      _carry[_ncarry++] = *ib++;
+      int r = _convert_carry(ob, oe);
+      if (r < 0) {
+        return false;
+      } else if (r == 0) {
+        // output full, give the byte back
+        --ib;
+        --_ncarry;
+        return true;
+      } else if (r == 1) {
+        // bytes left after the carried code point came from this chunk
+        ib -= _ncarry;
+        _ncarry = 0;
+      }
+    }
+    while (ib < ie) {
+      const char *b = ib;
+      _conv.convert(ib, ie, ob, oe);
+      _offset += ib - b;
+      if (ib == ie) {
+        break;
+      }
+      // find out why it stopped: the output, a tail or an error
+      const char *tb = ib;
+      char t[16];
+      char *tt = t;
+      _conv.convert(tb, ie, tt, t + sizeof(t));
+      if (tt != t) {
+        return true;
+      }
+      if (ie - ib < (std::ptrdiff_t)sizeof(_carry) && _conv.partial(ib, ie - ib)) {
+        while (ib < ie) {
+          _carry[_ncarry++] = *ib++;
+        }
+        break;
+      }
+      _bad = true;
+      return false;
+    }
+    return true;
+  }
+
+  // sink mode, convert a whole chunk
+  bool feed(bytes_view bs) {
+    assert(_sink);
+    const char *ib = bs.data();
+    const char *ie = bs.limit();
+    while (true) {
+      char *ob = _out.data() + _nout;
+      bool ok = convert(ib, ie, ob, _out.data() + _out.size());
+      _nout = ob - _out.data();
+      if (!ok || ib == ie) {
+        return ok;
+      }
+      _flush();
+    }
+  }
+
+  // end of input: flush the sink, drop the carried bytes and return their number,
+  // which is 0 for a clean end.
+  std::size_t finish() {
+    _flush();
+    std::size_t n = _ncarry;
+    _ncarry = 0;
+    return n;
+  }
+
+  bool good() const { return !_bad; }
+  bool bad() const { return _bad; }
+  // input bytes converted so far
+  std::size_t offset() const { return _offset; }
+
+private:
+  // 1 converted, 0 output full, -1 invalid, 2 still incomplete
+  int _convert_carry(char*& ob, char* oe) {
+    const char *cb = _carry;
+    char t[16];
+    char *tt = t;
+    _conv.convert(cb, _carry + _ncarry, tt, t + sizeof(t));
+    if (tt == t) {
+      if (_ncarry < (int)sizeof(_carry) && _conv.partial(_carry, _ncarry)) {
+        return 2;
+      }
+      _bad = true;
+      return -1;
+    }
+    if (oe - ob < tt - t) {
+      return 0;
+    }
+    ob = std::copy(t, tt, ob);
+    _offset += cb - _carry;
+    _ncarry -= cb - _carry;
+    return 1;
+  }
+
+  void _flush() {
+    if (_nout > 0) {
+      _sink(_out.data(), _nout);
+      _nout = 0;
+    }
+  }
+
+private:
+  Conv _conv;
+  sink_type _sink;
+  std::vector<char> _out;
+  std::size_t _nout;
+  char _carry[8];
+  int _ncarry;
+  std::size_t _offset;
+  bool _bad;
+};
+
+template<typename T1, typename T2>
+class transcoder: public basic_transcoder<detail::static_conv<T1, T2>> {
+  typedef basic_transcoder<detail::static_conv<T1, T2>> base;
+public:
+  typedef typename base::sink_type sink_type;
+
+  transcoder():base(detail::static_conv<T1, T2>()){}
+  explicit transcoder(sink_type sink, std::size_t n = 4096):base(detail::static_conv<T1, T2>(), sink, n){}
+};
+
+
+#if defined(MINICODE_FILES)
+///////////////////////////////////////////////////////////////////////////////
+//  files
+///////////////////////////////////////////////////////////////////////////////
+
+// read-only memory map of a whole file.
+// pipes, fifos and devices have no size to map, nor have some special files; they are read into memory.
+class mapped_file {
+public:
+  explicit mapped_file(const char* path):_data(nullptr),_size(0),_good(false) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) == 0) {
+      if (S_ISREG(st.st_mode) && st.st_size > 0) {
+        _size = st.st_size;
+        void *p = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+          ::madvise(p, _size, MADV_SEQUENTIAL);
+          _data = static_cast<const char*>(p);
+          _good = true;
+        }
+      } else {
+        _good = _read_all(fd);
+      }
+    }
+    ::close(fd);
+  }
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  ~mapped_file() {
+    if (_data != nullptr) {
+      ::munmap(const_cast<char*>(_data), _size);
+    }
+  }
+
+  bool good() const { return _good; }
+  // false if the contents were read and not mapped
+  bool mapped() const { return _data != nullptr; }
+  bytes_view data() const { return _data != nullptr ? bytes_view(_data, _size) : bytes_view(_buffer); }
+
+private:
+  bool _read_all(int fd) {
+    std::size_t n = 0;
+    _buffer.resize(1 << 16);
+    while (true) {
+      if (n == _buffer.size()) {
+        _buffer.resize(2 * n);
+      }
+      ssize_t r = ::read(fd, &_buffer[n], _buffer.size() - n);
+      if (r < 0 && errno == EINTR) {
+        continue;
+      }
+      if (r < 0) {
+        return false;
+      }
+      if (r == 0) {
+        break;
+      }
+      n += r;
+    }
+    _buffer.resize(n);
+    return true;
+  }
+
+  const char* _data;
+  std::size_t _size;
+  std::vector<char> _buffer;
+  bool _good;
+};
+
+// convert a file chunk by chunk, the output goes through a buffer of n bytes.
+// return the number of input bytes left, as convert does, -1 for an i/o error.
+template<typename T1, typename T2>
+long long convert_file(const char* in, const char* out, std::size_t n = 1 << 16) {
+  mapped_file mf(in);
+  if (!mf.good()) {
+    return -1;
+  }
+  std::FILE *f = std::fopen(out, "wb");
+  if (f == nullptr) {
+    return -1;
+  }
+  bool ok = true;
+  transcoder<T1, T2> tc([f, &ok](const char* b, std::size_t m) {
+    ok = ok && std::fwrite(b, 1, m, f) == m;
+  }, n);
+  bytes_view bs = mf.data();
+  // feed in slices so that only a slice of the map is hot at a time
+  for (std::size_t i = 0; i < bs.size() && tc.good(); i += 1 << 20) {
+    tc.feed(bytes_view(bs.data() + i, std::min<std::size_t>(bs.size() - i, 1 << 20)));
+  }
+  tc.finish();
+  ok = std::fclose(f) == 0 && ok;
+  return ok ? static_cast<long long>(bs.size() - tc.offset()) : -1;
+}
+
+// decode a whole file into ss, -1 for an i/o error
+template<typename T>
+long long decode_file(const char* in, str& ss) {
+  mapped_file mf(in);
+  if (!mf.good()) {
+    return -1;
+  }
+  return decode<T>(mf.data(), ss);
+}
+
+#endif // MINICODE_FILES
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  encode and decode operators of each encoding
+///////////////////////////////////////////////////////////////////////////////
+
+struct ascii {
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    std::uint32_t& u = uc.value();
+    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
+    if (bss[0] < 0x80) {
+      u = bss[0];
+      return 1;
+    } else {
+      return -1;
+    }
+  }
+
+  int operator()(const uchar uc, char *bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
+    if (u < 0x80) {
+      bss[0] = u;
+      return 1;
+    } else {
+      return -1;
+    }
+  }
+};
+
+struct utf8 {
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    std::uint32_t& u = uc.value();
+    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
+    if(bss[0] < 0x80 && n >= 1) {
+      u = bss[0];
+      return 1;
+    } else if (bss[0] < 0xe0 &&
+               n >= 2 &&
+               is_utf8_cont(bss[1])) {
+      u = ((bss[0] & 0x1f) << 6) |
+          (bss[1] & 0x3f);
+      return 2;
+    } else if (bss[0] < 0xf0 &&
+               n >= 3 &&
+               is_utf8_cont(bss[1]) &&
+               is_utf8_cont(bss[2])) {
+      u = ((bss[0] & 0x0f) << 12) |
+          ((bss[1] & 0x3f) << 6) |
+          (bss[2] & 0x3f);
+      return 3;
+    } else if (bss[0] < 0xf8 &&
+               n >= 4 &&
+               is_utf8_cont(bss[1]) &&
+               is_utf8_cont(bss[2]) &&
+               is_utf8_cont(bss[3])) {
+      u = ((bss[0] & 0x07) << 18) |
+          ((bss[1] & 0x3f) << 12) |
+          ((bss[2] & 0x3f) << 6) |
+          (bss[3] & 0x3f);
+      return 4;
+    } else {
+      return -1;
+    }
+  }
+
+  int operator()(const uchar uc, char* bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    if (!is_valid_unicode(u)) {
+      return -1;
+    }
+    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
+    if(u < 0x80 && n >= 1) {
+      bss[0] = u;
+      return 1;
+    } else if (u < 0x800 && n >= 2) {
+      bss[0] = (u & 07700) >> 6 | 0300;
+      bss[1] = (u & 077) | 0200;
+      return 2;
+    } else if (u < 0x10000 && n >= 3) {
+      bss[0] = (u & 0770000) >> 12 | 0340;
+      bss[1] = (u & 07700) >> 6 | 0200;
+      bss[2] = (u & 077) | 0200;
+      return 3;
+    } else if (u < 0x110000 && n >= 4) {
+      bss[0] = (u & 077000000) >> 18 | 0360;
+      bss[1] = (u & 0770000) >> 12 | 0200;
+      bss[2] = (u & 07700) >> 6 | 0200;
+      bss[3] = (u & 077) | 0200;
+      return 4;
+    } else {
+      return -1;
+    }
+  }
+};
+
+struct utf16le {
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    if (n < 2) {
+      return -1;
+    }
+    std::uint32_t& u = uc.value();
+    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
+    std::uint32_t x = bss[0] | (bss[1] << 8);
+    if (is_valid_unicode(x) && n >= 2) {
+      u = x;
+      return 2;
+    } else if (is_surrogate_high(x) && n >= 4){
+      std::uint32_t y = bss[2] | (bss[3] << 8);
+      if (is_surrogate_low(y)) {
+        u = surrogate_combine(x, y);
+        return 4;
+      } else {
+        return -1;
+      }
+    } else {
+      return -1;
+    }
+  }
+
+  int operator()(const uchar uc, char* bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
+    if (u < 0x10000 && !is_surrogate(u) && n >= 2) {
+      bss[0] = u & 0xff;
+      bss[1] = (u >> 8) & 0xff;
+      return 2;
+    } else if (0x10000 <= u && u <= 0x10ffff && n >= 4) {
+      std::uint32_t x, y;
+      surrogate_split(u, x, y);
+      bss[0] = x & 0xff;
+      bss[1] = (x >> 8) & 0xff;
+      bss[2] = y & 0xff;
+      bss[3] = (y >> 8) & 0xff;
+      return 4;
+    } else {
+      return -1;
+    }
+  }
+};
+
+struct utf16be {
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    if (n < 2) {
+      return -1;
+    }
+    std::uint32_t& u = uc.value();
+    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
+    std::uint32_t x = bss[1] | (bss[0] << 8);
+    if (is_valid_unicode(x) && n >= 2) {
+      u = x;
+      return 2;
+    } else if (is_surrogate_high(x) && n >= 4){
+      std::uint32_t y = bss[3] | (bss[2] << 8);
+      if (is_surrogate_low(y)) {
+        u = surrogate_combine(x, y);
+        return 4;
+      } else {
+        return -1;
+      }
+    } else {
+      return -1;
+    }
+  }
+
+  int operator()(const uchar uc, char* bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
+    if (u < 0x10000 && !is_surrogate(u) && n >= 2) {
+      bss[1] = u & 0xff;
+      bss[0] = (u >> 8) & 0xff;
+      return 2;
+    } else if (0x10000 <= u && u <= 0x10ffff && n >= 4) {
+      std::uint32_t x, y;
+      surrogate_split(u, x, y);
+      bss[1] = x & 0xff;
+      bss[0] = (x >> 8) & 0xff;
+      bss[3] = y & 0xff;
+      bss[2] = (y >> 8) & 0xff;
+      return 4;
+    } else {
+      return -1;
+    }
+  }
+};
+
+struct utf32le {
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    if (n < 4) {
+      return -1;
+    }
+    std::uint32_t& u = uc.value();
+    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
+    std::uint32_t x = bss[0] | (bss[1] << 8) | (bss[2] << 16) | (bss[3] << 24);
+    if (is_valid_unicode(x)) {
+      u = x;
+      return 4;
+    } else {
+      return -1;
+    }
+  }
+
+  int operator()(const uchar uc, char* bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
+    if (is_valid_unicode(u) && n >= 4) {
+      bss[0] = u & 0xff;
+      bss[1] = (u >> 8) & 0xff;
+      bss[2] = (u >> 16) & 0xff;
+      bss[3] = (u >>24) & 0xff;
+      return 4;
+    } else {
+      return -1;
+    }
+  }
+};
+
+struct utf32be {
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    if (n < 4) {
+      return -1;
+    }
+    std::uint32_t& u = uc.value();
+    const std::uint8_t *bss = reinterpret_cast<const uint8_t *>(bs);
+    std::uint32_t x = bss[3] | (bss[2] << 8) | (bss[1] << 16) | (bss[0] << 24);
+    if (is_valid_unicode(x)) {
+      u = x;
+      return 4;
+    } else {
+      return -1;
+    }
+  }
+
+  int operator()(const uchar uc, char* bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    std::uint8_t *bss = reinterpret_cast<uint8_t *>(bs);
+    if (is_valid_unicode(u) && n >= 4) {
+      bss[3] = u & 0xff;
+      bss[2] = (u >> 8) & 0xff;
+      bss[1] = (u >> 16) & 0xff;
+      bss[0] = (u >>24) & 0xff;
+      return 4;
+    } else {
+      return -1;
+    }
+  }
+};
+
+
+// single byte codecs: 0x00-0x7f is ascii, high() maps 0x80-0xff, 0xffff where a byte is unmapped.
+// encoding looks up a reverse table built from high() on first use.
+
+namespace detail {
+
+class single_byte_reverse {
+public:
+  explicit single_byte_reverse(const std::uint16_t* high):_index(1, 0),_blocks(256, 0) {
+    for (int i = 0; i < 128; ++i) {
+      std::uint32_t u = high[i];
+      if (u == 0xffff) {
+        continue;
+      }
+      std::size_t page = u >> 8;
+      if (page >= _index.size()) {
+        _index.resize(page + 1, 0);
+      }
+      // block 0 stays empty for the pages nothing maps to
+      if (_index[page] == 0) {
+        _index[page] = static_cast<std::uint8_t>(_blocks.size() / 256);
+        _blocks.resize(_blocks.size() + 256, 0);
+      }
+      _blocks[_index[page] * 256 + (u & 0xff)] = static_cast<std::uint8_t>(0x80 + i);
+    }
+  }
+
+  // the byte for code point u, -1 if there is none
+  int get(std::uint32_t u) const {
+    if (u < 0x80) {
+      return u;
+    }
+    std::size_t page = u >> 8;
+    std::uint8_t b = page < _index.size() ? _blocks[_index[page] * 256 + (u & 0xff)] : 0;
+    return b != 0 ? b : -1;
+  }
+
+private:
+  std::vector<std::uint8_t> _index;
+  std::vector<std::uint8_t> _blocks;
+};
+
+template<typename Codec>
+struct single_byte {
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    const std::uint8_t b = static_cast<std::uint8_t>(bs[0]);
+    std::uint32_t u = b < 0x80 ? b : Codec::high()[b - 0x80];
+    if (u == 0xffff) {
+      return -1;
+    }
+    uc.value() = u;
+    return 1;
+  }
+
+  int operator()(const uchar uc, char *bs, int n) {
+    assert(n > 0);
+    int b = reverse().get(uc.value());
+    if (b < 0) {
+      return -1;
+    }
+    bs[0] = static_cast<char>(b);
+    return 1;
+  }
+
+  static const single_byte_reverse& reverse() {
+    static const single_byte_reverse r(Codec::high());
+    return r;
+  }
+};
+
+} // namespace detail
+
+// iso-8859-1, western european
+struct latin1: detail::single_byte<latin1> {
+  static const std::uint16_t* high() {
+    static const std::uint16_t t[128] = {
+      0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+      0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+      0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+      0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+      0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+      0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+      0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+      0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+      0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+      0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+      0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+      0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+      0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+      0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+      0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+      0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+    };
+    return t;
+  }
+};
+
+// iso-8859-2, central european
+struct iso8859_2: detail::single_byte<iso8859_2> {
+  static const std::uint16_t* high() {
+    static const std::uint16_t t[128] = {
+      0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+      0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+      0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+      0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+      0x00a0, 0x0104, 0x02d8, 0x0141, 0x00a4, 0x013d, 0x015a, 0x00a7,
+      0x00a8, 0x0160, 0x015e, 0x0164, 0x0179, 0x00ad, 0x017d, 0x017b,
+      0x00b0, 0x0105, 0x02db, 0x0142, 0x00b4, 0x013e, 0x015b, 0x02c7,
+      0x00b8, 0x0161, 0x015f, 0x0165, 0x017a, 0x02dd, 0x017e, 0x017c,
+      0x0154, 0x00c1, 0x00c2, 0x0102, 0x00c4, 0x0139, 0x0106, 0x00c7,
+      0x010c, 0x00c9, 0x0118, 0x00cb, 0x011a, 0x00cd, 0x00ce, 0x010e,
+      0x0110, 0x0143, 0x0147, 0x00d3, 0x00d4, 0x0150, 0x00d6, 0x00d7,
+      0x0158, 0x016e, 0x00da, 0x0170, 0x00dc, 0x00dd, 0x0162, 0x00df,
+      0x0155, 0x00e1, 0x00e2, 0x0103, 0x00e4, 0x013a, 0x0107, 0x00e7,
+      0x010d, 0x00e9, 0x0119, 0x00eb, 0x011b, 0x00ed, 0x00ee, 0x010f,
+      0x0111, 0x0144, 0x0148, 0x00f3, 0x00f4, 0x0151, 0x00f6, 0x00f7,
+      0x0159, 0x016f, 0x00fa, 0x0171, 0x00fc, 0x00fd, 0x0163, 0x02d9,
+    };
+    return t;
+  }
+};
+
+// iso-8859-15, latin-1 with the euro sign
+struct iso8859_15: detail::single_byte<iso8859_15> {
+  static const std::uint16_t* high() {
+    static const std::uint16_t t[128] = {
+      0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+      0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+      0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+      0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+      0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x20ac, 0x00a5, 0x0160, 0x00a7,
+      0x0161, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+      0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x017d, 0x00b5, 0x00b6, 0x00b7,
+      0x017e, 0x00b9, 0x00ba, 0x00bb, 0x0152, 0x0153, 0x0178, 0x00bf,
+      0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+      0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+      0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+      0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+      0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+      0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+      0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+      0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+    };
+    return t;
+  }
+};
+
+// windows-1250, central european
+struct cp1250: detail::single_byte<cp1250> {
+  static const std::uint16_t* high() {
+    static const std::uint16_t t[128] = {
+      0x20ac, 0xffff, 0x201a, 0xffff, 0x201e, 0x2026, 0x2020, 0x2021,
+      0xffff, 0x2030, 0x0160, 0x2039, 0x015a, 0x0164, 0x017d, 0x0179,
+      0xffff, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+      0xffff, 0x2122, 0x0161, 0x203a, 0x015b, 0x0165, 0x017e, 0x017a,
+      0x00a0, 0x02c7, 0x02d8, 0x0141, 0x00a4, 0x0104, 0x00a6, 0x00a7,
+      0x00a8, 0x00a9, 0x015e, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x017b,
+      0x00b0, 0x00b1, 0x02db, 0x0142, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+      0x00b8, 0x0105, 0x015f, 0x00bb, 0x013d, 0x02dd, 0x013e, 0x017c,
+      0x0154, 0x00c1, 0x00c2, 0x0102, 0x00c4, 0x0139, 0x0106, 0x00c7,
+      0x010c, 0x00c9, 0x0118, 0x00cb, 0x011a, 0x00cd, 0x00ce, 0x010e,
+      0x0110, 0x0143, 0x0147, 0x00d3, 0x00d4, 0x0150, 0x00d6, 0x00d7,
+      0x0158, 0x016e, 0x00da, 0x0170, 0x00dc, 0x00dd, 0x0162, 0x00df,
+      0x0155, 0x00e1, 0x00e2, 0x0103, 0x00e4, 0x013a, 0x0107, 0x00e7,
+      0x010d, 0x00e9, 0x0119, 0x00eb, 0x011b, 0x00ed, 0x00ee, 0x010f,
+      0x0111, 0x0144, 0x0148, 0x00f3, 0x00f4, 0x0151, 0x00f6, 0x00f7,
+      0x0159, 0x016f, 0x00fa, 0x0171, 0x00fc, 0x00fd, 0x0163, 0x02d9,
+    };
+    return t;
+  }
+};
+
+// windows-1251, cyrillic
+struct cp1251: detail::single_byte<cp1251> {
+  static const std::uint16_t* high() {
+    static const std::uint16_t t[128] = {
+      0x0402, 0x0403, 0x201a, 0x0453, 0x201e, 0x2026, 0x2020, 0x2021,
+      0x20ac, 0x2030, 0x0409, 0x2039, 0x040a, 0x040c, 0x040b, 0x040f,
+      0x0452, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+      0xffff, 0x2122, 0x0459, 0x203a, 0x045a, 0x045c, 0x045b, 0x045f,
+      0x00a0, 0x040e, 0x045e, 0x0408, 0x00a4, 0x0490, 0x00a6, 0x00a7,
+      0x0401, 0x00a9, 0x0404, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x0407,
+      0x00b0, 0x00b1, 0x0406, 0x0456, 0x0491, 0x00b5, 0x00b6, 0x00b7,
+      0x0451, 0x2116, 0x0454, 0x00bb, 0x0458, 0x0405, 0x0455, 0x0457,
+      0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+      0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e, 0x041f,
+      0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+      0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d, 0x042e, 0x042f,
+      0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+      0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f,
+      0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+      0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e, 0x044f,
+    };
+    return t;
+  }
+};
+
+// windows-1252, western european
+struct cp1252: detail::single_byte<cp1252> {
+  static const std::uint16_t* high() {
+    static const std::uint16_t t[128] = {
+      0x20ac, 0xffff, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+      0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0xffff, 0x017d, 0xffff,
+      0xffff, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+      0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0xffff, 0x017e, 0x0178,
+      0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+      0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+      0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+      0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+      0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+      0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+      0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+      0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+      0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+      0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+      0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+      0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+    };
+    return t;
+  }
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  bulk kernels of each encoding
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// byte order helpers, the simd ones assume a little-endian host as x86 is
+
+template<bool BE>
+inline std::uint32_t load16(const char* p) {
+  const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(p);
+  return BE ? (b[0] << 8 | b[1]) : (b[1] << 8 | b[0]);
+}
+
+template<bool BE>
+inline void store16(char* p, std::uint32_t u) {
+  std::uint8_t *b = reinterpret_cast<std::uint8_t*>(p);
+  b[BE ? 0 : 1] = (u >> 8) & 0xff;
+  b[BE ? 1 : 0] = u & 0xff;
+}
+
+template<bool BE>
+inline std::uint32_t load32(const char* p) {
+  const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(p);
+  return BE ? (std::uint32_t(b[0]) << 24 | b[1] << 16 | b[2] << 8 | b[3])
+            : (std::uint32_t(b[3]) << 24 | b[2] << 16 | b[1] << 8 | b[0]);
+}
+
+template<bool BE>
+inline void store32(char* p, std::uint32_t u) {
+  std::uint8_t *b = reinterpret_cast<std::uint8_t*>(p);
+  b[BE ? 0 : 3] = (u >> 24) & 0xff;
+  b[BE ? 1 : 2] = (u >> 16) & 0xff;
+  b[BE ? 2 : 1] = (u >> 8) & 0xff;
+  b[BE ? 3 : 0] = u & 0xff;
+}
+
+#if defined(MINICODE_SSE2)
+inline __m128i bswap16x8(__m128i v) {
+  return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+inline __m128i bswap32x4(__m128i v) {
+  return bswap16x8(_mm_or_si128(_mm_slli_epi32(v, 16), _mm_srli_epi32(v, 16)));
+}
+
+template<bool BE>
+inline __m128i load16x8(const char* p) {
+  __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  return BE ? bswap16x8(v) : v;
+}
+
+template<bool BE>
+inline void store16x8(char* p, __m128i v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), BE ? bswap16x8(v) : v);
+}
+
+template<bool BE>
+inline __m128i load32x4(const char* p) {
+  __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  return BE ? bswap32x4(v) : v;
+}
+
+template<bool BE>
+inline void store32x4(char* p, __m128i v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(p), BE ? bswap32x4(v) : v);
+}
+
+// mask of the 16-bit lanes holding a surrogate
+inline int surrogate_mask16(__m128i v) {
+  return _mm_movemask_epi8(_mm_cmpeq_epi16(
+      _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xf800))),
+      _mm_set1_epi16(static_cast<short>(0xd800))));
+}
+
+// mask of the 16 values of u that are surrogates
+inline std::uint32_t surrogate_lanes(const std::uint16_t* u) {
+  const __m128i *p = reinterpret_cast<const __m128i*>(u);
+  const __m128i f8 = _mm_set1_epi16(static_cast<short>(0xf800));
+  const __m128i d8 = _mm_set1_epi16(static_cast<short>(0xd800));
+  __m128i lo = _mm_cmpeq_epi16(_mm_and_si128(_mm_loadu_si128(p), f8), d8);
+  __m128i hi = _mm_cmpeq_epi16(_mm_and_si128(_mm_loadu_si128(p + 1), f8), d8);
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(lo, hi)));
+}
+
+// true if all the 32-bit lanes are below 0x10000 and not surrogates
+inline bool all_bmp32(__m128i v) {
+  __m128i z = _mm_setzero_si128();
+  __m128i hi = _mm_cmpeq_epi32(_mm_srli_epi32(v, 16), z);
+  __m128i sg = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(0xf800)), _mm_set1_epi32(0xd800));
+  return _mm_movemask_epi8(_mm_andnot_si128(sg, hi)) == 0xffff;
+}
+
+// true if all the 32-bit lanes are valid unicode
+inline bool all_valid32(__m128i v) {
+  // unsigned compare by flipping the sign bit
+  __m128i flip = _mm_set1_epi32(static_cast<int>(0x80000000u));
+  __m128i lt = _mm_cmplt_epi32(_mm_xor_si128(v, flip), _mm_set1_epi32(static_cast<int>(0x80110000u)));
+  __m128i sg = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(0xfffff800)), _mm_set1_epi32(0xd800));
+  return _mm_movemask_epi8(_mm_andnot_si128(sg, lt)) == 0xffff;
+}
+
+// classify 16 bytes of utf-8 and decode them if they are regular:
+// five 3-byte sequences in the first 15 bytes, or eight 2-byte sequences.
+// return the number of code points written to u, 0 for anything else.
+inline int utf8_block(const char* bb, std::uint32_t* u, int& len) {
+  const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(bb);
+  __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bb));
+  int cont = _mm_movemask_epi8(_mm_cmpeq_epi8(
+      _mm_and_si128(v, _mm_set1_epi8(static_cast<char>(0xc0))),
+      _mm_set1_epi8(static_cast<char>(0x80))));
+  if ((cont & 0x7fff) == 0x6db6) {
+    int lead3 = _mm_movemask_epi8(_mm_cmpeq_epi8(
+        _mm_and_si128(v, _mm_set1_epi8(static_cast<char>(0xf0))),
+        _mm_set1_epi8(static_cast<char>(0xe0))));
+    if ((lead3 & 0x1249) == 0x1249) {
+      for (int i = 0; i < 5; ++i) {
+        u[i] = ((b[3 * i] & 0x0f) << 12) | ((b[3 * i + 1] & 0x3f) << 6) | (b[3 * i + 2] & 0x3f);
+      }
+      len = 15;
+      return 5;
+    }
+  } else if (cont == 0xaaaa) {
+    int lead2 = _mm_movemask_epi8(_mm_cmpeq_epi8(
+        _mm_and_si128(v, _mm_set1_epi8(static_cast<char>(0xe0))),
+        _mm_set1_epi8(static_cast<char>(0xc0))));
+    if (lead2 == 0x5555) {
+      for (int i = 0; i < 8; ++i) {
+        u[i] = ((b[2 * i] & 0x1f) << 6) | (b[2 * i + 1] & 0x3f);
+      }
+      len = 16;
+      return 8;
+    }
+  }
+  return 0;
+}
+#if defined(MINICODE_AVX2_KERNELS)
+// the positions of the set bits of each byte, in order, to pack the lanes a mask selects
+struct pack_table {
+  std::uint8_t index[256][8];
+
+  pack_table() {
+    for (int m = 0; m < 256; ++m) {
+      int k = 0;
+      for (int i = 0; i < 8; ++i) {
+        if (m >> i & 1) {
+          index[m][k++] = static_cast<std::uint8_t>(i);
+        }
+      }
+      for (; k < 8; ++k) {
+        index[m][k] = 0;
+      }
+    }
+  }
+
+  static const pack_table& get() {
+    static const pack_table t;
+    return t;
+  }
+};
+
+MINICODE_TARGET_AVX2
+inline int pack_lanes_avx2(const std::uint16_t* u, std::uint32_t mask, std::uint32_t* o) {
+  const pack_table& t = pack_table::get();
+  int k = 0;
+  for (int h = 0; h < 2; ++h) {
+    std::uint32_t m = mask >> (8 * h) & 0xff;
+    __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(u + 8 * h)));
+    __m256i i = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(t.index[m])));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(o + k), _mm256_permutevar8x32_epi32(v, i));
+    k += popcount(m);
+  }
+  return k;
+}
+#endif
+
+// write the lanes of u that mask selects to o, in order, and return how many.
+// o must have room for 16, the ones after the packed lanes are scratch.
+inline int pack_lanes(const std::uint16_t* u, std::uint32_t mask, std::uint32_t* o) {
+#if defined(MINICODE_AVX2_KERNELS)
+  if (avx2_enabled()) {
+    return pack_lanes_avx2(u, mask, o);
+  }
+#endif
+  // every lane is written, only the selected ones move the output on
+  int k = 0;
+  for (int i = 0; i < 16; ++i) {
+    o[k] = u[i];
+    k += mask >> i & 1;
+  }
+  return k;
+}
+
+// decode the sequences of one to three bytes at the start of 16 bytes of utf-8, in any mix.
+// each value is computed at the last byte of its sequence, the bits of ends mark them in u.
+// return the number of bytes taken, up to where a sequence starts, or 0 if the block does not
+// start with such a sequence. the values are what the utf8 functor gives.
+inline int utf8_mixed_block(const char* bb, std::uint16_t* u, std::uint32_t& ends) {
+  __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bb));
+  const __m128i c0 = _mm_set1_epi8(static_cast<char>(0xc0));
+  const __m128i f0 = _mm_set1_epi8(static_cast<char>(0xf0));
+  std::uint32_t cont = static_cast<std::uint32_t>(_mm_movemask_epi8(
+      _mm_cmpeq_epi8(_mm_and_si128(v, c0), _mm_set1_epi8(static_cast<char>(0x80)))));
+  std::uint32_t lead2 = static_cast<std::uint32_t>(_mm_movemask_epi8(
+      _mm_cmpeq_epi8(_mm_and_si128(v, _mm_set1_epi8(static_cast<char>(0xe0))), c0)));
+  std::uint32_t lead3 = static_cast<std::uint32_t>(_mm_movemask_epi8(
+      _mm_cmpeq_epi8(_mm_and_si128(v, f0), _mm_set1_epi8(static_cast<char>(0xe0)))));
+  // 4-byte leads and the bytes that start nothing end the block
+  std::uint32_t other = static_cast<std::uint32_t>(_mm_movemask_epi8(
+      _mm_cmpeq_epi8(_mm_and_si128(v, f0), f0)));
+  // a sequence starts at every other byte, and right after the block if the last one ends there
+  std::uint32_t starts = (~cont & 0xffff) | 0x10000;
+  int p = other != 0 ? ctz(other) : 16;
+  // the continuations must be exactly the ones the leads call for, up to p that must start a sequence.
+  // at the first byte where they differ the block ends before the sequence that holds it.
+  std::uint32_t need = (lead2 | lead3) << 1 | lead3 << 2;
+  std::uint32_t bad = (cont ^ need) & ((2u << p) - 1);
+  if (bad != 0) {
+    std::uint32_t before = starts & ((1u << ctz(bad)) - 1);
+    p = before != 0 ? msb(before) : 0;
+  }
+  if (p == 0) {
+    return 0;
+  }
+  ends = (starts >> 1) & ((1u << p) - 1);
+  // the bytes one and two back, zero before the block as it starts a sequence
+  __m128i v1 = _mm_slli_si128(v, 1);
+  __m128i v2 = _mm_slli_si128(v, 2);
+  const __m128i z = _mm_setzero_si128();
+  const __m128i x3f = _mm_set1_epi16(0x3f);
+  for (int h = 0; h < 2; ++h) {
+    __m128i b0 = h == 0 ? _mm_unpacklo_epi8(v, z) : _mm_unpackhi_epi8(v, z);
+    __m128i b1 = h == 0 ? _mm_unpacklo_epi8(v1, z) : _mm_unpackhi_epi8(v1, z);
+    __m128i b2 = h == 0 ? _mm_unpacklo_epi8(v2, z) : _mm_unpackhi_epi8(v2, z);
+    __m128i ascii = _mm_cmplt_epi16(b0, _mm_set1_epi16(0x80));
+    __m128i cont1 = _mm_cmpeq_epi16(_mm_and_si128(b1, _mm_set1_epi16(0xc0)), _mm_set1_epi16(0x80));
+    // the last byte gives 6 bits, or 7 for ascii
+    __m128i x = _mm_and_si128(b0, _mm_or_si128(x3f, _mm_and_si128(ascii, _mm_set1_epi16(0x40))));
+    // the byte before gives 6 bits as a continuation, 5 as the lead of two
+    __m128i y = _mm_and_si128(b1, _mm_or_si128(_mm_set1_epi16(0x1f), _mm_and_si128(cont1, _mm_set1_epi16(0x20))));
+    x = _mm_or_si128(x, _mm_andnot_si128(ascii, _mm_slli_epi16(y, 6)));
+    // the lead of three gives 4 bits
+    __m128i w = _mm_slli_epi16(_mm_and_si128(b2, _mm_set1_epi16(0x0f)), 12);
+    x = _mm_or_si128(x, _mm_and_si128(_mm_andnot_si128(ascii, cont1), w));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(u + 8 * h), x);
+  }
+  return p;
+}
+#endif
+
+template<> struct utf_traits<utf8> { static const int bits = 8; static const bool big = false; };
+template<> struct utf_traits<utf16le> { static const int bits = 16; static const bool big = false; };
+template<> struct utf_traits<utf16be> { static const int bits = 16; static const bool big = true; };
+template<> struct utf_traits<utf32le> { static const int bits = 32; static const bool big = false; };
+template<> struct utf_traits<utf32be> { static const int bits = 32; static const bool big = true; };
+
+template<typename T>
+struct utf_traits<T, typename std::enable_if<std::is_base_of<single_byte<T>, T>::value>::type> {
+  static const int bits = 1;
+  static const bool big = false;
+};
+
+template<typename T>
+struct partial<T, 8> {
+  static bool test(const char* bs, std::size_t n) {
+    const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(bs);
+    std::size_t len = b[0] < 0x80 ? 1 : b[0] < 0xe0 ? 2 : b[0] < 0xf0 ? 3 : b[0] < 0xf8 ? 4 : 0;
+    if (n >= len) {
+      return false;
+    }
+    for (std::size_t i = 1; i < n; ++i) {
+      if (!is_utf8_cont(b[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+template<typename T>
+struct partial<T, 16> {
+  static bool test(const char* bs, std::size_t n) {
+    return n < 2 || (n < 4 && is_surrogate_high(load16<utf_traits<T>::big>(bs)));
+  }
+};
+
+template<typename T>
+struct partial<T, 32> {
+  static bool test(const char*, std::size_t n) {
+    return n < 4;
+  }
+};
+
+// every byte inside a utf-8 sequence is a continuation, so any other byte starts one
+template<typename T>
+struct boundary<T, 8> {
+  static const bool splittable = true;
+  static std::size_t next(const char* bs, std::size_t n, std::size_t pos) {
+    while (pos < n && is_utf8_cont(bs[pos])) {
+      ++pos;
+    }
+    return pos;
+  }
+};
+
+template<typename T>
+struct boundary<T, 16> {
+  static const bool splittable = true;
+  static std::size_t next(const char* bs, std::size_t n, std::size_t pos) {
+    pos &= ~std::size_t(1);
+    if (pos + 2 <= n && is_surrogate_low(load16<utf_traits<T>::big>(bs + pos))) {
+      pos += 2;
+    }
+    return pos;
+  }
+};
+
+// every byte is a code point
+template<typename T>
+struct boundary<T, 1> {
+  static const bool splittable = true;
+  static std::size_t next(const char*, std::size_t, std::size_t pos) { return pos; }
+};
+
+template<typename T>
+struct boundary<T, 32> {
+  static const bool splittable = true;
+  static std::size_t next(const char*, std::size_t, std::size_t pos) {
+    return pos & ~std::size_t(3);
+  }
+};
+
+// utf-8 to utf-8: copy what is well-formed,
+// the rest goes through the functors which normalize or reject it.
+template<typename T1, typename T2>
+struct transcode<T1, T2, 8, 8> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+#if defined(MINICODE_SSE2)
+      while (ie - ib >= 16 && oe - ob >= 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ib));
+        if (_mm_movemask_epi8(v) != 0) {
+          break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ob), v);
+        ib += 16;
+        ob += 16;
+      }
+      if (ib == ie || ob == oe) {
+        break;
+      }
+#endif
+      const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(ib);
+      int p = utf8_strict_len(b, ie - ib);
+      if (p > 0 && oe - ob >= p) {
+        for (int i = 0; i < p; ++i) {
+          ob[i] = ib[i];
+        }
+        ib += p;
+        ob += p;
+      } else if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+template<typename T1, typename T2>
+struct transcode<T1, T2, 8, 16> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+#if defined(MINICODE_SSE2)
+      const bool BE = utf_traits<T2>::big;
+      const __m128i z = _mm_setzero_si128();
+      while (ie - ib >= 16 && oe - ob >= 32) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ib));
+        if (_mm_movemask_epi8(v) == 0) {
+          store16x8<BE>(ob, _mm_unpacklo_epi8(v, z));
+          store16x8<BE>(ob + 16, _mm_unpackhi_epi8(v, z));
+          ib += 16;
+          ob += 32;
+          continue;
+        }
+        // 4-byte sequences go one at a time
+        if (static_cast<std::uint8_t>(*ib) >= 0xf0) {
+          break;
+        }
+        // blocks of 2-byte or of 3-byte sequences alone go the short way
+        if (static_cast<std::uint8_t>(*ib) >= 0x80) {
+          std::uint32_t u[8];
+          int len = 0;
+          int m = utf8_block(ib, u, len);
+          if (m > 0) {
+            bool ok = true;
+            for (int i = 0; i < m; ++i) {
+              ok = ok && !is_surrogate(u[i]);
+            }
+            if (!ok) {
+              break;
+            }
+            for (int i = 0; i < m; ++i) {
+              store16<BE>(ob + 2 * i, u[i]);
+            }
+            ib += len;
+            ob += 2 * m;
+            continue;
+          }
+        }
+        std::uint16_t w[16];
+        std::uint32_t ends = 0;
+        int len = utf8_mixed_block(ib, w, ends);
+        if (len == 0 || (surrogate_lanes(w) & ends) != 0) {
+          break;
+        }
+        // every lane is stored, only the ends move the output on
+        int k = 0;
+        for (int i = 0; i < 16; ++i) {
+          store16<BE>(ob + 2 * k, w[i]);
+          k += ends >> i & 1;
+        }
+        ib += len;
+        ob += 2 * k;
+      }
+#endif
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+template<typename T1, typename T2>
+struct transcode<T1, T2, 8, 32> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+#if defined(MINICODE_SSE2)
+      const bool BE = utf_traits<T2>::big;
+      const __m128i z = _mm_setzero_si128();
+      while (ie - ib >= 16 && oe - ob >= 64) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ib));
+        if (_mm_movemask_epi8(v) == 0) {
+          __m128i lo = _mm_unpacklo_epi8(v, z);
+          __m128i hi = _mm_unpackhi_epi8(v, z);
+          store32x4<BE>(ob, _mm_unpacklo_epi16(lo, z));
+          store32x4<BE>(ob + 16, _mm_unpackhi_epi16(lo, z));
+          store32x4<BE>(ob + 32, _mm_unpacklo_epi16(hi, z));
+          store32x4<BE>(ob + 48, _mm_unpackhi_epi16(hi, z));
+          ib += 16;
+          ob += 64;
+          continue;
+        }
+        // 4-byte sequences go one at a time
+        if (static_cast<std::uint8_t>(*ib) >= 0xf0) {
+          break;
+        }
+        // blocks of 2-byte or of 3-byte sequences alone go the short way
+        if (static_cast<std::uint8_t>(*ib) >= 0x80) {
+          std::uint32_t u[8];
+          int len = 0;
+          int m = utf8_block(ib, u, len);
+          if (m > 0) {
+            bool ok = true;
+            for (int i = 0; i < m; ++i) {
+              ok = ok && !is_surrogate(u[i]);
+            }
+            if (!ok) {
+              break;
+            }
+            for (int i = 0; i < m; ++i) {
+              store32<BE>(ob + 4 * i, u[i]);
+            }
+            ib += len;
+            ob += 4 * m;
+            continue;
+          }
+        }
+        std::uint16_t w[16];
+        std::uint32_t ends = 0;
+        int len = utf8_mixed_block(ib, w, ends);
+        if (len == 0 || (surrogate_lanes(w) & ends) != 0) {
+          break;
+        }
+        // every lane is stored, only the ends move the output on
+        int k = 0;
+        for (int i = 0; i < 16; ++i) {
+          store32<BE>(ob + 4 * k, w[i]);
+          k += ends >> i & 1;
+        }
+        ib += len;
+        ob += 4 * k;
+      }
+#endif
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+template<typename T1, typename T2>
+struct transcode<T1, T2, 16, 8> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+#if defined(MINICODE_SSE2)
+      const bool BE = utf_traits<T1>::big;
+      const __m128i m7 = _mm_set1_epi16(static_cast<short>(0xff80));
+      const __m128i z = _mm_setzero_si128();
+      while (ie - ib >= 16 && oe - ob >= 8) {
+        __m128i v = load16x8<BE>(ib);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, m7), z)) != 0xffff) {
+          break;
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(ob), _mm_packus_epi16(v, v));
+        ib += 16;
+        ob += 8;
+      }
+#endif
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+template<typename T1, typename T2>
+struct transcode<T1, T2, 32, 8> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+#if defined(MINICODE_SSE2)
+      const bool BE = utf_traits<T1>::big;
+      const __m128i m7 = _mm_set1_epi32(~0x7f);
+      const __m128i z = _mm_setzero_si128();
+      while (ie - ib >= 64 && oe - ob >= 16) {
+        __m128i a = load32x4<BE>(ib);
+        __m128i b = load32x4<BE>(ib + 16);
+        __m128i c = load32x4<BE>(ib + 32);
+        __m128i d = load32x4<BE>(ib + 48);
+        __m128i o = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(o, m7), z)) != 0xffff) {
+          break;
+        }
+        __m128i x = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ob), x);
+        ib += 64;
+        ob += 16;
+      }
+#endif
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+// utf-16 to utf-16: validate, then copy or swap the bytes
+template<typename T1, typename T2>
+struct transcode<T1, T2, 16, 16> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    const bool B1 = utf_traits<T1>::big;
+    const bool B2 = utf_traits<T2>::big;
+    while (ie - ib >= 2 && oe - ob >= 2) {
+#if defined(MINICODE_SSE2)
+      while (ie - ib >= 16 && oe - ob >= 16) {
+        __m128i v = load16x8<B1>(ib);
+        if (surrogate_mask16(v) != 0) {
+          break;
+        }
+        store16x8<B2>(ob, v);
+        ib += 16;
+        ob += 16;
+      }
+      if (ie - ib < 2 || oe - ob < 2) {
+        break;
+      }
+#endif
+      std::uint32_t x = load16<B1>(ib);
+      if (!is_surrogate(x)) {
+        store16<B2>(ob, x);
+        ib += 2;
+        ob += 2;
+      } else if (is_surrogate_high(x) && ie - ib >= 4 && oe - ob >= 4 &&
+                 is_surrogate_low(load16<B1>(ib + 2))) {
+        store16<B2>(ob, x);
+        store16<B2>(ob + 2, load16<B1>(ib + 2));
+        ib += 4;
+        ob += 4;
+      } else {
+        break;
+      }
+    }
+  }
+};
+
+template<typename T1, typename T2>
+struct transcode<T1, T2, 16, 32> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+#if defined(MINICODE_SSE2)
+      const bool B1 = utf_traits<T1>::big;
+      const bool B2 = utf_traits<T2>::big;
+      const __m128i z = _mm_setzero_si128();
+      while (ie - ib >= 16 && oe - ob >= 32) {
+        __m128i v = load16x8<B1>(ib);
+        if (surrogate_mask16(v) != 0) {
+          break;
+        }
+        store32x4<B2>(ob, _mm_unpacklo_epi16(v, z));
+        store32x4<B2>(ob + 16, _mm_unpackhi_epi16(v, z));
+        ib += 16;
+        ob += 32;
+      }
+#endif
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+template<typename T1, typename T2>
+struct transcode<T1, T2, 32, 16> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+#if defined(MINICODE_SSE2)
+      const bool B1 = utf_traits<T1>::big;
+      const bool B2 = utf_traits<T2>::big;
+      while (ie - ib >= 32 && oe - ob >= 16) {
+        __m128i a = load32x4<B1>(ib);
+        __m128i b = load32x4<B1>(ib + 16);
+        if (!all_bmp32(a) || !all_bmp32(b)) {
+          break;
+        }
+        store16x8<B2>(ob, pack32to16(a, b));
+        ib += 32;
+        ob += 16;
+      }
+#endif
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+// utf-32 to utf-32: validate, then copy or swap the bytes
+template<typename T1, typename T2>
+struct transcode<T1, T2, 32, 32> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    const bool B1 = utf_traits<T1>::big;
+    const bool B2 = utf_traits<T2>::big;
+#if defined(MINICODE_SSE2)
+    while (ie - ib >= 16 && oe - ob >= 16) {
+      __m128i v = load32x4<B1>(ib);
+      if (!all_valid32(v)) {
+        break;
+      }
+      store32x4<B2>(ob, v);
+      ib += 16;
+      ob += 16;
+    }
+#endif
+    while (ie - ib >= 4 && oe - ob >= 4) {
+      std::uint32_t x = load32<B1>(ib);
+      if (!is_valid_unicode(x)) {
+        break;
+      }
+      store32<B2>(ob, x);
+      ib += 4;
+      ob += 4;
+    }
+  }
+};
+
+// utf-8 keeps the exact semantics of the utf8 functor:
+// the lead byte gives the length, all the following bytes must be continuation.
+template<>
+struct bulk<utf8> {
+  static void decode(const char*& bb, const char* be, uchar*& sb, uchar* se) {
+    utf8 t;
+    while (bb < be && sb < se) {
+      decode_ascii(bb, be, sb, se);
+      while (bb < be && sb < se) {
+#if defined(MINICODE_SSE2)
+        // ascii mixed with other sequences goes by blocks, a longer run of ascii back to decode_ascii.
+        // 4-byte sequences go one at a time.
+        if (be - bb >= 16 && se - sb >= 16 && static_cast<std::uint8_t>(*bb) < 0xf0) {
+          // blocks of 2-byte or of 3-byte sequences alone go the short way
+          if (static_cast<std::uint8_t>(*bb) >= 0x80) {
+            int len = 0;
+            int m = utf8_block(bb, reinterpret_cast<std::uint32_t*>(sb), len);
+            if (m > 0) {
+              sb += m;
+              bb += len;
+              continue;
+            }
+          }
+          std::uint16_t u[16];
+          std::uint32_t ends = 0;
+          int len = utf8_mixed_block(bb, u, ends);
+          if (len > 0) {
+            int n = pack_lanes(u, ends, reinterpret_cast<std::uint32_t*>(sb));
+            sb += n;
+            bb += len;
+            if (n == 16 && be - bb >= 32 && _mm_movemask_epi8(_mm_or_si128(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bb)),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(bb + 16)))) == 0) {
+              break;
+            }
+            continue;
+          }
+        }
+#endif
+        if (static_cast<std::uint8_t>(*bb) < 0x80) {
+          break;
+        }
+        int p = t(bb, clamp_len(be - bb), *sb);
+        if (p < 0) {
+          return;
+        }
+        bb += p;
+        ++sb;
+      }
+    }
+  }
+
+  static void encode(const uchar*& sb, const uchar* se, char*& bb, char* be) {
+    utf8 t;
+    while (sb < se && bb < be) {
+      encode_ascii(sb, se, bb, be);
+      while (sb < se && bb < be && sb->value() >= 0x80) {
+        int p = t(*sb, bb, clamp_len(be - bb));
+        if (p < 0) {
+          return;
+        }
+        ++sb;
+        bb += p;
+      }
+    }
+  }
+};
+
+// single byte codecs: ascii runs go through the simd helpers,
+// the high bytes through the tables
+template<typename T>
+struct bulk<T, typename std::enable_if<utf_traits<T>::bits == 1>::type> {
+  static void decode(const char*& bb, const char* be, uchar*& sb, uchar* se) {
+    const std::uint16_t *high = T::high();
+    while (bb < be && sb < se) {
+      decode_ascii(bb, be, sb, se);
+      while (bb < be && sb < se && static_cast<std::uint8_t>(*bb) >= 0x80) {
+        std::uint16_t u = high[static_cast<std::uint8_t>(*bb) - 0x80];
+        if (u == 0xffff) {
+          return;
+        }
+        sb->value() = u;
+        ++bb;
+        ++sb;
+      }
+    }
+  }
+
+  static void encode(const uchar*& sb, const uchar* se, char*& bb, char* be) {
+    const single_byte_reverse& r = T::reverse();
+    while (sb < se && bb < be) {
+      encode_ascii(sb, se, bb, be);
+      while (sb < se && bb < be && sb->value() >= 0x80) {
+        int b = r.get(sb->value());
+        if (b < 0) {
+          return;
+        }
+        *bb = static_cast<char>(b);
+        ++sb;
+        ++bb;
+      }
+    }
+  }
+};
+
+// copy the leading ascii run of [ib, ie) to [ob, oe), it is the same in utf-8 and the single byte codecs
+inline void copy_ascii(const char*& ib, const char* ie, char*& ob, char* oe) {
+#if defined(MINICODE_SSE2)
+  while (ie - ib >= 16 && oe - ob >= 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ib));
+    if (_mm_movemask_epi8(v) != 0) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ob), v);
+    ib += 16;
+    ob += 16;
+  }
+#endif
+  while (ib < ie && ob < oe && static_cast<std::uint8_t>(*ib) < 0x80) {
+    *ob++ = *ib++;
+  }
+}
+
+// single byte codec to anything: decode a block to uchar and encode it,
+// one byte per code point tells how much input the encoder took
+template<typename T1, typename T2, int B2>
+struct transcode<T1, T2, 1, B2> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    uchar buff[256];
+    while (ib < ie && ob < oe) {
+      const char *b = ib;
+      uchar *s = buff;
+      bulk<T1>::decode(b, std::min(ie, ib + 256), s, buff + 256);
+      const uchar *u = buff;
+      bulk<T2>::encode(u, s, ob, oe);
+      ib += u - buff;
+      if (u < s || s < buff + 256) {
+        break;
+      }
+    }
+  }
+};
+
+// single byte codec to utf-8, the tables only hold bmp code points
+template<typename T1, typename T2>
+struct transcode<T1, T2, 1, 8> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    const std::uint16_t *high = T1::high();
+    while (ib < ie && ob < oe) {
+      copy_ascii(ib, ie, ob, oe);
+      while (ib < ie && static_cast<std::uint8_t>(*ib) >= 0x80) {
+        std::uint32_t u = high[static_cast<std::uint8_t>(*ib) - 0x80];
+        if (u == 0xffff) {
+          return;
+        }
+        if (u < 0x800) {
+          if (oe - ob < 2) {
+            return;
+          }
+          ob[0] = static_cast<char>(0xc0 | (u >> 6));
+          ob[1] = static_cast<char>(0x80 | (u & 0x3f));
+          ob += 2;
+        } else {
+          if (oe - ob < 3) {
+            return;
+          }
+          ob[0] = static_cast<char>(0xe0 | (u >> 12));
+          ob[1] = static_cast<char>(0x80 | ((u >> 6) & 0x3f));
+          ob[2] = static_cast<char>(0x80 | (u & 0x3f));
+          ob += 3;
+        }
+        ++ib;
+      }
+    }
+  }
+};
+
+// utf-8 to single byte codec
+template<typename T1, typename T2>
+struct transcode<T1, T2, 8, 1> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+      copy_ascii(ib, ie, ob, oe);
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+
+// validation kernels
+
+#if defined(MINICODE_AVX2_KERNELS)
+// the lookup validator of keiser and lemire, 32 bytes at a time:
+// three nibble lookups classify each byte with the one before it,
+// the bytes two and three back tell where a continuation is required.
+template<int K>
+MINICODE_TARGET_AVX2
+inline __m256i prev_bytes(__m256i v, __m256i prev) {
+  return _mm256_alignr_epi8(v, _mm256_permute2x128_si256(prev, v, 0x21), 16 - K);
+}
+
+MINICODE_TARGET_AVX2
+inline __m256i nibble_lookup(__m256i idx, char t0, char t1, char t2, char t3, char t4, char t5, char t6, char t7,
+                             char t8, char t9, char ta, char tb, char tc, char td, char te, char tf) {
+  __m256i t = _mm256_setr_epi8(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, ta, tb, tc, td, te, tf,
+                               t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, ta, tb, tc, td, te, tf);
+  return _mm256_shuffle_epi8(t, idx);
+}
+
+// non-zero lanes mark an error in v, given the block before it
+MINICODE_TARGET_AVX2
+inline __m256i utf8_errors(__m256i v, __m256i prev) {
+  const char too_short = 1 << 0;    // lead followed by ascii or a lead
+  const char too_long = 1 << 1;     // ascii followed by a continuation
+  const char overlong3 = 1 << 2;    // e0 80-9f
+  const char too_large = 1 << 3;    // f4 90-bf, f5-ff
+  const char surrogate = 1 << 4;    // ed a0-bf
+  const char overlong2 = 1 << 5;    // c0-c1
+  const char too_large1000 = 1 << 6;
+  const char overlong4 = 1 << 6;    // f0 80-8f
+  const char two_conts = static_cast<char>(1 << 7);
+  const char carry = too_short | too_long | two_conts;
+  const __m256i lo = _mm256_set1_epi8(0x0f);
+  __m256i prev1 = prev_bytes<1>(v, prev);
+  __m256i b1h = nibble_lookup(_mm256_and_si256(_mm256_srli_epi16(prev1, 4), lo),
+      too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+      two_conts, two_conts, two_conts, two_conts,
+      too_short | overlong2, too_short, too_short | overlong3 | surrogate,
+      too_short | too_large | too_large1000 | overlong4);
+  __m256i b1l = nibble_lookup(_mm256_and_si256(prev1, lo),
+      carry | overlong3 | overlong2 | overlong4, carry | overlong2, carry, carry,
+      carry | too_large, carry | too_large | too_large1000, carry | too_large | too_large1000,
+      carry | too_large | too_large1000, carry | too_large | too_large1000, carry | too_large | too_large1000,
+      carry | too_large | too_large1000, carry | too_large | too_large1000, carry | too_large | too_large1000,
+      carry | too_large | too_large1000 | surrogate, carry | too_large | too_large1000,
+      carry | too_large | too_large1000);
+  __m256i b2h = nibble_lookup(_mm256_and_si256(_mm256_srli_epi16(v, 4), lo),
+      too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+      too_long | overlong2 | two_conts | overlong3 | too_large1000 | overlong4,
+      too_long | overlong2 | two_conts | overlong3 | too_large,
+      too_long | overlong2 | two_conts | surrogate | too_large,
+      too_long | overlong2 | two_conts | surrogate | too_large,
+      too_short, too_short, too_short, too_short);
+  __m256i special = _mm256_and_si256(_mm256_and_si256(b1h, b1l), b2h);
+  // a third or fourth byte must be a continuation, and then no other case applies
+  __m256i third = _mm256_subs_epu8(prev_bytes<2>(v, prev), _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+  __m256i fourth = _mm256_subs_epu8(prev_bytes<3>(v, prev), _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+  __m256i must = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+  return _mm256_xor_si256(must, special);
+}
+
+// non-zero lanes if the last bytes of v start a sequence that goes on past it
+MINICODE_TARGET_AVX2
+inline __m256i utf8_unfinished(__m256i v) {
+  const __m256i max = _mm256_setr_epi8(
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      static_cast<char>(0xf0 - 1), static_cast<char>(0xe0 - 1), static_cast<char>(0xc0 - 1));
+  return _mm256_subs_epu8(v, max);
+}
+
+// skip the 32-byte blocks that are valid, stop at the block with an error or near the end.
+// a sequence may be cut at the returned pointer.
+MINICODE_TARGET_AVX2
+inline const char* utf8_valid_blocks(const char* bb, const char* be) {
+  __m256i prev = _mm256_setzero_si256();
+  __m256i unfinished = _mm256_setzero_si256();
+  while (be - bb >= 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bb));
+    __m256i err;
+    if (_mm256_movemask_epi8(v) == 0) {
+      err = unfinished;
+      unfinished = _mm256_setzero_si256();
+    } else {
+      err = utf8_errors(v, prev);
+      unfinished = utf8_unfinished(v);
+    }
+    if (!_mm256_testz_si256(err, err)) {
+      break;
+    }
+    prev = v;
+    bb += 32;
+  }
+  return bb;
+}
+#endif
+
+// end of the well-formed utf-8 prefix of [bb, be)
+inline const char* utf8_valid(const char* bb, const char* be) {
+  const char *p = bb;
+#if defined(MINICODE_AVX2_KERNELS)
+  if (avx2_enabled()) {
+    p = utf8_valid_blocks(bb, be);
+    // back to the lead of a sequence cut at p
+    const char *q = p;
+    while (q > bb && p - q < 3 && is_utf8_cont(static_cast<std::uint8_t>(q[-1]))) {
+      --q;
+    }
+    if (q > bb && static_cast<std::uint8_t>(q[-1]) >= 0xc0) {
+      --q;
+    }
+    p = q;
+  }
+#endif
+  while (p < be) {
+#if defined(MINICODE_SSE2)
+    if (be - p >= 16 && _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) == 0) {
+      p += 16;
+      continue;
+    }
+#endif
+    int n = utf8_strict_len(reinterpret_cast<const std::uint8_t*>(p), be - p);
+    if (n == 0) {
+      break;
+    }
+    p += n;
+  }
+  return p;
+}
+
+template<typename T>
+struct scan<T, 8> {
+  static const char* run(const char* bb, const char* be, std::size_t& n) {
+    const char *p = utf8_valid(bb, be);
+    n += count_leads(bb, p - bb);
+    return p;
+  }
+};
+
+// utf-16: blocks without surrogates, pairs one at a time
+template<typename T>
+struct scan<T, 16> {
+  static const char* run(const char* bb, const char* be, std::size_t& n) {
+    const bool BE = utf_traits<T>::big;
+    while (be - bb >= 2) {
+#if defined(MINICODE_SSE2)
+      if (be - bb >= 16 && surrogate_mask16(load16x8<BE>(bb)) == 0) {
+        bb += 16;
+        n += 8;
+        continue;
+      }
+#endif
+      std::uint32_t x = load16<BE>(bb);
+      if (!is_surrogate(x)) {
+        bb += 2;
+      } else if (is_surrogate_high(x) && be - bb >= 4 && is_surrogate_low(load16<BE>(bb + 2))) {
+        bb += 4;
+      } else {
+        break;
+      }
+      ++n;
+    }
+    return bb;
+  }
+};
+
+template<typename T>
+struct scan<T, 32> {
+  static const char* run(const char* bb, const char* be, std::size_t& n) {
+    const bool BE = utf_traits<T>::big;
+    const char *b0 = bb;
+#if defined(MINICODE_SSE2)
+    while (be - bb >= 16 && all_valid32(load32x4<BE>(bb))) {
+      bb += 16;
+    }
+#endif
+    while (be - bb >= 4 && is_valid_unicode(load32<BE>(bb))) {
+      bb += 4;
+    }
+    n += (bb - b0) / 4;
+    return bb;
+  }
+};
+
+// single byte codecs: every byte is a code point if the table maps it
+template<typename T>
+struct scan<T, 1> {
+  static const char* run(const char* bb, const char* be, std::size_t& n) {
+    const std::uint16_t *high = T::high();
+    const char *b0 = bb;
+    while (bb < be) {
+#if defined(MINICODE_SSE2)
+      if (be - bb >= 16 && _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bb))) == 0) {
+        bb += 16;
+        continue;
+      }
+#endif
+      std::uint8_t c = static_cast<std::uint8_t>(*bb);
+      if (c >= 0x80 && high[c - 0x80] == 0xffff) {
+        break;
+      }
+      ++bb;
+    }
+    n += bb - b0;
+    return bb;
+  }
+};
+
+// decoded lengths are the code points that scan counts
+template<typename T>
+struct decoded_size<T, 1>: scan<T, 1> {};
+
+template<typename T>
+struct decoded_size<T, 8>: scan<T, 8> {};
+
+template<typename T>
+struct decoded_size<T, 16>: scan<T, 16> {};
+
+template<typename T>
+struct decoded_size<T, 32>: scan<T, 32> {};
+
+// bytes of a valid code point in the utf encoding of B bits
+template<int B>
+inline int utf_size(std::uint32_t u) {
+  return B == 8 ? (u < 0x80 ? 1 : u < 0x800 ? 2 : u < 0x10000 ? 3 : 4) : B == 16 ? (u < 0x10000 ? 2 : 4) : 4;
+}
+
+#if defined(MINICODE_SSE2)
+// the same for four valid code points, one per lane
+template<int B>
+inline __m128i utf_size32x4(__m128i v) {
+  __m128i m3 = _mm_cmpgt_epi32(v, _mm_set1_epi32(0xffff));
+  if (B == 8) {
+    __m128i m1 = _mm_cmpgt_epi32(v, _mm_set1_epi32(0x7f));
+    __m128i m2 = _mm_cmpgt_epi32(v, _mm_set1_epi32(0x7ff));
+    return _mm_sub_epi32(_mm_sub_epi32(_mm_sub_epi32(_mm_set1_epi32(1), m1), m2), m3);
+  }
+  return B == 16 ? _mm_sub_epi32(_mm_set1_epi32(2), _mm_add_epi32(m3, m3)) : _mm_set1_epi32(4);
+}
+
+// and for eight utf-16 units without surrogates, summed in pairs
+template<int B>
+inline __m128i utf_size16x8(__m128i v) {
+  if (B == 8) {
+    const __m128i z = _mm_setzero_si128();
+    __m128i m1 = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xff80))), z);
+    __m128i m2 = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xf800))), z);
+    return _mm_madd_epi16(_mm_add_epi16(_mm_add_epi16(_mm_set1_epi16(3), m1), m2), _mm_set1_epi16(1));
+  }
+  return _mm_set1_epi32(B == 16 ? 4 : 8);
+}
+
+inline std::size_t sum32x4(__m128i v) {
+  std::uint32_t t[4];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(t), v);
+  return std::size_t(t[0]) + t[1] + t[2] + t[3];
+}
+#endif
+
+// the encodings of B bits take every valid code point.
+// the simd loops sum per lane, in rounds short enough not to overflow.
+template<typename T, int B>
+struct utf_encoded_size {
+  static const uchar* run(const uchar* sb, const uchar* se, std::size_t& n) {
+    while (sb < se) {
+#if defined(MINICODE_SSE2)
+      __m128i sum = _mm_setzero_si128();
+      for (int k = 0; k < (1 << 20) && se - sb >= 4; ++k) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sb));
+        if (!all_valid32(v)) {
+          break;
+        }
+        sum = _mm_add_epi32(sum, utf_size32x4<B>(v));
+        sb += 4;
+      }
+      n += sum32x4(sum);
+      if (sb == se) {
+        break;
+      }
+#endif
+      std::uint32_t u = sb->value();
+      if (!is_valid_unicode(u)) {
+        break;
+      }
+      n += utf_size<B>(u);
+      ++sb;
+    }
+    return sb;
+  }
+};
+
+template<typename T>
+struct encoded_size<T, 8>: utf_encoded_size<T, 8> {};
+
+template<typename T>
+struct encoded_size<T, 16>: utf_encoded_size<T, 16> {};
+
+template<typename T>
+struct encoded_size<T, 32>: utf_encoded_size<T, 32> {};
+
+// from utf-8, well-formed sequences: the code points are the lead bytes, 4-byte ones take a surrogate pair
+template<typename T1, typename T2, int B2>
+struct converted_size<T1, T2, 8, B2> {
+  static const char* run(const char* bb, const char* be, std::size_t& n) {
+    if (B2 != 8 && B2 != 16 && B2 != 32) {
+      return bb;
+    }
+    const char *p = utf8_valid(bb, be);
+    std::size_t k = p - bb;
+    if (B2 == 8) {
+      n += k;
+    } else if (B2 == 32) {
+      n += 4 * count_leads(bb, k);
+    } else {
+      std::size_t fours = 0;
+      std::size_t i = 0;
+#if defined(MINICODE_SSE2)
+      const __m128i f0 = _mm_set1_epi8(static_cast<char>(0xf0));
+      for (; k - i >= 16; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bb + i));
+        fours += popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, f0), f0)));
+      }
+#endif
+      for (; i < k; ++i) {
+        fours += static_cast<std::uint8_t>(bb[i]) >= 0xf0;
+      }
+      n += 2 * (count_leads(bb, k) + fours);
+    }
+    return p;
+  }
+};
+
+// from utf-16, a surrogate pair takes 4 bytes in every utf encoding
+template<typename T1, typename T2, int B2>
+struct converted_size<T1, T2, 16, B2> {
+  static const char* run(const char* bb, const char* be, std::size_t& n) {
+    if (B2 != 8 && B2 != 16 && B2 != 32) {
+      return bb;
+    }
+    const bool BE = utf_traits<T1>::big;
+    while (be - bb >= 2) {
+#if defined(MINICODE_SSE2)
+      __m128i sum = _mm_setzero_si128();
+      for (int k = 0; k < (1 << 20) && be - bb >= 16; ++k) {
+        __m128i v = load16x8<BE>(bb);
+        if (surrogate_mask16(v) != 0) {
+          break;
+        }
+        sum = _mm_add_epi32(sum, utf_size16x8<B2>(v));
+        bb += 16;
+      }
+      n += sum32x4(sum);
+      if (be - bb < 2) {
+        break;
+      }
+#endif
+      std::uint32_t x = load16<BE>(bb);
+      if (!is_surrogate(x)) {
+        n += utf_size<B2>(x);
+        bb += 2;
+      } else if (is_surrogate_high(x) && be - bb >= 4 && is_surrogate_low(load16<BE>(bb + 2))) {
+        n += 4;
+        bb += 4;
+      } else {
+        break;
+      }
+    }
+    return bb;
+  }
+};
+
+template<typename T1, typename T2, int B2>
+struct converted_size<T1, T2, 32, B2> {
+  static const char* run(const char* bb, const char* be, std::size_t& n) {
+    if (B2 != 8 && B2 != 16 && B2 != 32) {
+      return bb;
+    }
+    const bool BE = utf_traits<T1>::big;
+    while (be - bb >= 4) {
+#if defined(MINICODE_SSE2)
+      __m128i sum = _mm_setzero_si128();
+      for (int k = 0; k < (1 << 20) && be - bb >= 16; ++k) {
+        __m128i v = load32x4<BE>(bb);
+        if (!all_valid32(v)) {
+          break;
+        }
+        sum = _mm_add_epi32(sum, utf_size32x4<B2>(v));
+        bb += 16;
+      }
+      n += sum32x4(sum);
+      if (be - bb < 4) {
+        break;
+      }
+#endif
+      std::uint32_t u = load32<BE>(bb);
+      if (!is_valid_unicode(u)) {
+        break;
+      }
+      n += utf_size<B2>(u);
+      bb += 4;
+    }
+    return bb;
+  }
+};
+
+template<typename T>
+struct step_back<T, 1> {
+  static const char* prev(const char*, const char* p) { return p - 1; }
+};
+
+template<typename T>
+struct step_back<T, 8> {
+  static const char* prev(const char* b, const char* p) {
+    const char *q = p - 1;
+    while (q > b && p - q < 4 && is_utf8_cont(static_cast<std::uint8_t>(*q))) {
+      --q;
+    }
+    return q;
+  }
+};
+
+template<typename T>
+struct step_back<T, 16> {
+  static const char* prev(const char* b, const char* p) {
+    const bool BE = utf_traits<T>::big;
+    if (p - b >= 4 && is_surrogate_low(load16<BE>(p - 2)) && is_surrogate_high(load16<BE>(p - 4))) {
+      return p - 4;
+    }
+    return p - std::min<std::ptrdiff_t>(2, p - b);
+  }
+};
+
+template<typename T>
+struct step_back<T, 32> {
+  static const char* prev(const char* b, const char* p) { return p - std::min<std::ptrdiff_t>(4, p - b); }
+};
+
+} // namespace detail
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  utf-8 str
+///////////////////////////////////////////////////////////////////////////////
+
+// text kept as well-formed utf-8 with the indexing api of str.
+// the byte offset of every 64th code point is recorded the first time an index is needed,
+// pure ascii text needs no record at all. the lazy index is not safe to build
+// from several threads at once, touch size() first to share it.
+class u8str {
+public:
+  static const std::size_t stride = 64;
+
+  u8str():_size(0),_indexed(true){}
+  u8str(const u8str&) = default;
+  u8str(u8str&&) = default;
+  u8str& operator=(const u8str&) = default;
+  u8str& operator=(u8str&&) = default;
+
+  explicit u8str(str_view s):_size(0),_indexed(false) { encode<utf8>(s, _data); }
+  explicit u8str(bytes_view bs):_size(0),_indexed(false) { assign(bs); }
+  // take over the memory of bs, cut at its first error
+  explicit u8str(bytes&& bs):_size(0),_indexed(false) {
+    std::size_t i = first_error<utf8>(bs);
+    _data = std::move(bs);
+    _data.resize(i);
+  }
+
+  // keep the well-formed prefix of bs, return the number of bytes left
+  int assign(bytes_view bs) {
+    std::size_t i = first_error<utf8>(bs);
+    _data.assign(bs.data(), bs.data() + i);
+    _indexed = false;
+    _marks.clear();
+    return bs.size() - i;
+  }
+
+  bool operator==(const u8str& s) const { return _data == s._data; }
+  bool operator!=(const u8str& s) const { return _data != s._data; }
+
+  // code points
+  std::size_t size() const { _build(); return _size; }
+  bytes_view as_bytes() const { return _data.as_view(); }
+  bool is_ascii() const { _build(); return _size == _data.size(); }
+
+  uchar operator[](int idx) const {
+    std::size_t i = offset(_real_index(idx));
+    uchar uc(0u);
+    utf8()(_data.data() + i, _data.size() - i, uc);
+    return uc;
+  }
+
+  // byte offset of code point i, for 0 <= i <= size()
+  std::size_t offset(std::size_t i) const {
+    _build();
+    if (_marks.empty()) {
+      return i;
+    }
+    const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(_data.data());
+    std::size_t p = _marks[i / stride];
+    for (std::size_t k = i % stride; k > 0; --k) {
+      p += b[p] < 0x80 ? 1 : (b[p] < 0xe0 ? 2 : (b[p] < 0xf0 ? 3 : 4));
+    }
+    return p;
+  }
+
+  // code point index at byte offset p, which must start a code point
+  std::size_t index(std::size_t p) const {
+    _build();
+    if (_marks.empty()) {
+      return p;
+    }
+    std::size_t k = std::upper_bound(_marks.begin(), _marks.end(), p) - _marks.begin() - 1;
+    return k * stride + detail::count_leads(_data.data() + _marks[k], p - _marks[k]);
+  }
+
+  int find(const uchar value, int start, int stop) const {
+    char pat[4];
+    int n = utf8()(value, pat, 4);
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    if (n < 0 || start >= stop) {
+      return -1;
+    }
+    const char *b = _data.data();
+    const char *e = b + offset(stop);
+    for (const char *p = b + offset(start); p + n <= e; ++p) {
+      p = static_cast<const char*>(std::memchr(p, pat[0], e - p));
+      if (p == nullptr || p + n > e) {
+        break;
+      }
+      if (std::memcmp(p, pat, n) == 0) {
+        return index(p - b);
+      }
+    }
+    return -1;
+  }
+
+  int find(const uchar value, int start) const { return find(value, start, size()); }
+  int find(const uchar value) const { return find(value, 0, size()); }
+
+  int rfind(const uchar value, int start, int stop) const {
+    char pat[4];
+    int n = utf8()(value, pat, 4);
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    if (n < 0 || start >= stop) {
+      return -1;
+    }
+    const char *b = _data.data() + offset(start);
+    for (const char *p = _data.data() + offset(stop) - n; p >= b; --p) {
+      if (*p == pat[0] && std::memcmp(p, pat, n) == 0) {
+        return index(p - _data.data());
+      }
+    }
+    return -1;
+  }
+
+  int rfind(const uchar value, int start) const { return rfind(value, start, size()); }
+  int rfind(const uchar value) const { return rfind(value, 0, size()); }
+
+  u8str subrange(int start, int stop) const {
+    start = _clamp_index(start);
+    stop = _clamp_index(stop);
+    u8str r;
+    if (start < stop) {
+      std::size_t b = offset(start);
+      r._data.assign(_data.data() + b, _data.data() + offset(stop));
+      r._indexed = false;
+    }
+    return r;
+  }
+
+  str to_str() const {
+    str s;
+    decode<utf8>(_data, s);
+    return s;
+  }
+
+private:
+  // count the code points and record every stride-th offset,
+  // 16 bytes at a time, stepping bytewise only in the blocks that cross a mark
+  void _build() const {
+    if (_indexed) {
+      return;
+    }
+    const char *b = _data.data();
+    std::size_t n = _data.size();
+    _marks.clear();
+    std::size_t count = detail::count_leads(b, n);
+    if (count < n) {
+      _marks.reserve(count / stride + 1);
+      std::size_t c = 0;
+      std::size_t i = 0;
+      while (i < n) {
+        std::size_t next = _marks.size() * stride;
+        std::size_t m = std::min<std::size_t>(16, n - i);
+        std::size_t k = detail::count_leads(b + i, m);
+        if (c + k <= next) {
+          c += k;
+          i += m;
+          continue;
+        }
+        for (std::size_t j = i; j < i + m; ++j) {
+          if (!is_utf8_cont(b[j])) {
+            if (c % stride == 0) {
+              _marks.push_back(j);
+            }
+            ++c;
+          }
+        }
+        i += m;
+      }
+      // a mark at the end makes offset(size()) work for exact multiples
+      if (count % stride == 0) {
+        _marks.push_back(n);
+      }
+    }
+    _size = count;
+    _indexed = true;
+  }
+
+  int _real_index(int idx) const { return idx < 0 ? idx + (int)size() : idx; }
+  int _clamp_index(int idx) const {
+    idx = _real_index(idx);
+    return idx < 0 ? 0 : (idx > (int)size() ? (int)size() : idx);
+  }
+
+private:
+  bytes _data;
+  mutable std::vector<std::size_t> _marks;
+  mutable std::size_t _size;
+  mutable bool _indexed;
+};
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  offsets
+///////////////////////////////////////////////////////////////////////////////
+
+// what a position in utf-8 text counts: bytes, utf-16 units or code points
+enum class offset_unit { utf8, utf16, codepoint };
+
+namespace detail {
+
+// units of the code points that start in [b, b + n), the text is taken as valid utf-8
+inline std::size_t count_units(const char* b, std::size_t n, offset_unit u) {
+  if (u == offset_unit::utf8) {
+    return n;
+  }
+  const bool wide = u == offset_unit::utf16;
+  std::size_t r = 0;
+  std::size_t i = 0;
+#if defined(MINICODE_SSE2)
+  const __m128i c0 = _mm_set1_epi8(static_cast<char>(0xc0));
+  const __m128i c8 = _mm_set1_epi8(static_cast<char>(0x80));
+  const __m128i f0 = _mm_set1_epi8(static_cast<char>(0xf0));
+  for (; n - i >= 16; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    int m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, c0), c8));
+    r += 16 - popcount(static_cast<std::uint32_t>(m));
+    if (wide) {
+      // a 4-byte sequence is a surrogate pair
+      r += popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, f0), f0))));
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    std::uint8_t c = static_cast<std::uint8_t>(b[i]);
+    r += !is_utf8_cont(c) + (wide && c >= 0xf0);
+  }
+  return r;
+}
+
+// start of the code point that holds byte pos, pos past the end is the end
+inline std::size_t align_back(const char* b, std::size_t n, std::size_t pos) {
+  pos = std::min(pos, n);
+  for (int k = 0; k < 3 && pos > 0 && pos < n && is_utf8_cont(static_cast<std::uint8_t>(b[pos])); ++k) {
+    --pos;
+  }
+  return pos;
+}
+
+// byte offset of the code point k units into [b, b + n),
+// a unit inside a code point gives its start
+inline std::size_t advance_units(const char* b, std::size_t n, std::size_t k, offset_unit u) {
+  if (u == offset_unit::utf8) {
+    return align_back(b, n, k);
+  }
+  std::size_t i = 0;
+  std::size_t acc = 0;
+  // whole blocks first, a sequence cut by the block end counts in the block of its lead
+  while (n - i >= 16) {
+    std::size_t c = count_units(b + i, 16, u);
+    if (acc + c > k) {
+      break;
+    }
+    acc += c;
+    i += 16;
+  }
+  for (; i < n; ++i) {
+    std::uint8_t c = static_cast<std::uint8_t>(b[i]);
+    if (is_utf8_cont(c)) {
+      continue;
+    }
+    std::size_t w = u == offset_unit::utf16 && c >= 0xf0 ? 2 : 1;
+    if (acc + w > k) {
+      return i;
+    }
+    acc += w;
+  }
+  return n;
+}
+
+} // namespace detail
+
+// translate pos in the utf-8 text u8 from one unit to another, without decoding it.
+// a position inside a code point means its start, one past the end means the end.
+inline std::size_t convert_offset(bytes_view u8, std::size_t pos, offset_unit from, offset_unit to) {
+  std::size_t b = detail::advance_units(u8.data(), u8.size(), pos, from);
+  return detail::count_units(u8.data(), b, to);
+}
+
+struct text_position {
+  std::size_t line;
+  std::size_t column;
+};
+
+// line starts and offset marks of a utf-8 document for repeated lookups,
+// each one a binary search and a scan of at most one stride.
+// lines end at '\n'. the index keeps a view, the text must outlive it.
+class line_index {
+public:
+  static const std::size_t stride = 256;
+
+  explicit line_index(bytes_view u8):_text(u8) {
+    const char *b = u8.data();
+    const std::size_t n = u8.size();
+    std::size_t at[3] = {0, 0, 0};
+    std::size_t pos = 0;
+    while (true) {
+      _lines.push_back(_marks[0].size());
+      const char *nl = detail::find_elem(b + pos, b + n, '\n');
+      std::size_t end = nl < b + n ? nl - b + 1 : n;
+      while (true) {
+        _add(at);
+        std::size_t next = end - pos > stride ? detail::align_back(b, n, pos + stride) : end;
+        if (next <= pos) {
+          next = end;
+        }
+        at[1] += detail::count_units(b + pos, next - pos, offset_unit::utf16);
+        at[2] += detail::count_units(b + pos, next - pos, offset_unit::codepoint);
+        at[0] = next;
+        pos = next;
+        if (pos == end) {
+          break;
+        }
+      }
+      if (nl == b + n) {
+        break;
+      }
+    }
+    // an end mark for the last segment
+    _add(at);
+  }
+
+  std::size_t lines() const { return _lines.size(); }
+
+  // same as convert_offset
+  std::size_t offset(std::size_t pos, offset_unit from, offset_unit to) const {
+    std::size_t m = _mark(pos, from);
+    std::size_t b = _marks[0][m];
+    std::size_t n = _marks[0][std::min(m + 1, _marks[0].size() - 1)] - b;
+    std::size_t p = detail::advance_units(_text.data() + b, n, pos - _marks[_i(from)][m], from);
+    return _marks[_i(to)][m] + detail::count_units(_text.data() + b, p, to);
+  }
+
+  // line and column of pos, all in unit u
+  text_position position(std::size_t pos, offset_unit u) const {
+    std::size_t p = offset(pos, u, u);
+    const std::vector<std::size_t>& ms = _marks[_i(u)];
+    std::size_t k = std::upper_bound(_lines.begin(), _lines.end(), p, [&ms](std::size_t v, std::size_t l) {
+      return v < ms[l];
+    }) - _lines.begin() - 1;
+    text_position r = {k, p - ms[_lines[k]]};
+    return r;
+  }
+
+  // offset of a line and column given in unit u, in unit to.
+  // a column past the end of the line is its end, before the '\n'.
+  std::size_t offset(text_position tp, offset_unit u, offset_unit to) const {
+    const std::vector<std::size_t>& ms = _marks[_i(u)];
+    if (tp.line >= _lines.size()) {
+      return _marks[_i(to)].back();
+    }
+    std::size_t b = ms[_lines[tp.line]];
+    std::size_t e = ms.back();
+    if (tp.line + 1 < _lines.size()) {
+      e = ms[_lines[tp.line + 1]] - 1;
+    }
+    return offset(std::min(b + tp.column, e), u, to);
+  }
+
+private:
+  static int _i(offset_unit u) { return static_cast<int>(u); }
+
+  void _add(const std::size_t* at) {
+    if (_marks[0].empty() || _marks[0].back() != at[0]) {
+      for (int i = 0; i < 3; ++i) {
+        _marks[i].push_back(at[i]);
+      }
+    }
+  }
+
+  // last mark at or before pos
+  std::size_t _mark(std::size_t pos, offset_unit u) const {
+    const std::vector<std::size_t>& ms = _marks[_i(u)];
+    return std::upper_bound(ms.begin() + 1, ms.end(), pos) - ms.begin() - 1;
+  }
+
+  bytes_view _text;
+  // offset of each mark in bytes, utf-16 units and code points
+  std::vector<std::size_t> _marks[3];
+  // the mark at the start of each line
+  std::vector<std::size_t> _lines;
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  columns
+///////////////////////////////////////////////////////////////////////////////
+
+// many short strings in one buffer, row i is values[offsets[i], offsets[i + 1]),
+// the string layout of arrow. errors has a bit for each row, lowest bit first,
+// set where the row has input that could not be converted.
+struct column {
+  bytes values;
+  std::vector<std::int32_t> offsets;
+  std::vector<std::uint8_t> errors;
+
+  std::size_t rows() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+  bytes_view row(std::size_t i) const { return bytes_view(values.data() + offsets[i], values.data() + offsets[i + 1]); }
+  bool error(std::size_t i) const { return (errors[i >> 3] >> (i & 7)) & 1; }
+};
+
+namespace detail {
+
+inline std::int32_t column_offset(std::size_t n) {
+  if (n > 0x7fffffff) {
+    throw std::length_error("minicode: column too large for 32-bit offsets");
+  }
+  return static_cast<std::int32_t>(n);
+}
+
+// the common case: every row starts on a code point boundary and the whole column converts.
+// then one kernel pass over all rows sizes the output, and the rows are converted into it
+// back to back, their offsets are where the output pointer stands after each.
+// return false, with nothing written, if the column is not like that.
+template<typename T1, typename T2>
+bool convert_clean_column(const char* vs, const std::int32_t* offsets, std::size_t rows, column& out) {
+  const char *b = vs + offsets[0];
+  const char *e = vs + offsets[rows];
+  if (!boundary<T1>::splittable) {
+    return false;
+  }
+  for (std::size_t i = 1; i < rows; ++i) {
+    std::size_t pos = offsets[i] - offsets[0];
+    if (boundary<T1>::next(b, e - b, pos) != pos) {
+      return false;
+    }
+  }
+  const char *ib = b;
+  std::size_t n = convert_length<T1, T2>(ib, e);
+  if (ib != e) {
+    return false;
+  }
+  column_offset(n);
+  out.values.resize(n);
+  char *o = out.values.data();
+  char *ob = o;
+  for (std::size_t i = 0; i < rows; ++i) {
+    ib = vs + offsets[i];
+    transcode<T1, T2>::convert(ib, vs + offsets[i + 1], ob, o + n);
+    out.offsets[i + 1] = static_cast<std::int32_t>(ob - o);
+  }
+  return true;
+}
+
+} // namespace detail
+
+// convert a whole column into out, whose buffers are reused.
+// offsets has one entry more than there are rows and may start past 0, as a slice does,
+// out.offsets start at 0. a row with an error holds what the policy makes of it,
+// with errors::strict what comes before the error, and errors::raise throws at the first one.
+// return the number of rows with an error.
+template<typename T1, typename T2, typename P = errors::strict>
+std::size_t convert_column(bytes_view values, view<std::int32_t> offsets, column& out) {
+  std::size_t rows = offsets.size() > 0 ? offsets.size() - 1 : 0;
+  const char *vs = values.data();
+  const std::int32_t *os = offsets.data();
+  assert(rows == 0 || (os[0] >= 0 && static_cast<std::size_t>(os[rows]) <= values.size()));
+  out.values.clear();
+  out.offsets.assign(rows + 1, 0);
+  out.errors.assign((rows + 7) / 8, 0);
+  if (rows == 0 || detail::convert_clean_column<T1, T2>(vs, os, rows, out)) {
+    return 0;
+  }
+  // row by row, sized first so that the output is allocated once
+  std::size_t n = 0;
+  for (std::size_t i = 0; i < rows; ++i) {
+    const char *ib = vs + os[i];
+    n += detail::convert_length<T1, T2, P>(ib, vs + os[i + 1]);
+    out.offsets[i + 1] = detail::column_offset(n);
+  }
+  out.values.resize(n);
+  char *o = out.values.data();
+  std::size_t bad = 0;
+  for (std::size_t i = 0; i < rows; ++i) {
+    const char *ib = vs + os[i];
+    const char *ie = vs + os[i + 1];
+    char *ob = o + out.offsets[i];
+    char *oe = o + out.offsets[i + 1];
+    detail::transcode<T1, T2>::convert(ib, ie, ob, oe);
+    if (ib < ie) {
+      ++bad;
+      out.errors[i >> 3] |= static_cast<std::uint8_t>(1u << (i & 7));
+      if (detail::raises<P>::value) {
+        detail::raise_convert<T1, T2>(ib, ie, ib - vs);
+      }
+      detail::checked_transcode<T1, T2, P>::convert(ib, ie, ob, oe);
+    }
+  }
+  return bad;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  runtime codecs
+///////////////////////////////////////////////////////////////////////////////
+
+// the widest kernels this build runs on this cpu
+inline const char* simd_level() {
+  if (detail::avx2_enabled()) {
+    return "avx2";
+  }
+#if defined(MINICODE_SSE2)
+  return "sse2";
+#else
+  return "scalar";
+#endif
+}
+
+namespace detail {
+
+// the place of a built-in utf-16 or utf-32 encoding in the pair tables of the runtime codecs, -1 for the others
+template<typename T> struct utf_id { static const int value = -1; };
+template<> struct utf_id<utf16le> { static const int value = 0; };
+template<> struct utf_id<utf16be> { static const int value = 1; };
+template<> struct utf_id<utf32le> { static const int value = 2; };
+template<> struct utf_id<utf32be> { static const int value = 3; };
+
+} // namespace detail
+
+// an encoding chosen at run time, a table of kernel pointers
+struct codec {
+  typedef void (*decode_fn)(const char*&, const char*, uchar*&, uchar*);
+  typedef void (*encode_fn)(const uchar*&, const uchar*, char*&, char*);
+  typedef void (*convert_fn)(const char*&, const char*, char*&, char*);
+  typedef bool (*partial_fn)(const char*, std::size_t);
+  typedef std::size_t (*decode_length_fn)(const char*&, const char*);
+  typedef std::size_t (*encode_length_fn)(const uchar*&, const uchar*);
+
+  struct kernels {
+    decode_fn decode;
+    encode_fn encode;
+    convert_fn to_utf8;
+    convert_fn from_utf8;
+    // the output lengths of the four above, up to the first error
+    decode_length_fn decode_length;
+    encode_length_fn encode_length;
+    decode_length_fn to_utf8_length;
+    decode_length_fn from_utf8_length;
+  };
+
+  const char* name;
+  // other names, separated by spaces
+  const char* aliases;
+  bool utf8;
+  // 0 to 3 for utf-16le, utf-16be, utf-32le and utf-32be, -1 for the others
+  int utf;
+  partial_fn partial;
+  // the kernels encode, decode and convert run. the one simd tier is avx2,
+  // taken inside the kernels when the cpu has it, sse2 or plain code otherwise
+  kernels simd;
+  // the portable kernels, to check the others against
+  kernels scalar;
+};
+
+template<typename T>
+codec make_codec(const char* name, const char* aliases = "") {
+  codec c;
+  c.name = name;
+  c.aliases = aliases;
+  c.utf8 = std::is_same<T, utf8>::value;
+  c.utf = detail::utf_id<T>::value;
+  c.partial = &detail::partial<T>::test;
+  c.simd.decode = &detail::bulk<T>::decode;
+  c.simd.encode = &detail::bulk<T>::encode;
+  c.simd.to_utf8 = &detail::transcode<T, utf8>::convert;
+  c.simd.from_utf8 = &detail::transcode<utf8, T>::convert;
+  c.simd.decode_length = &detail::decode_length<T, errors::strict>;
+  c.simd.encode_length = &detail::encode_length<T, errors::strict>;
+  c.simd.to_utf8_length = &detail::convert_length<T, utf8, errors::strict>;
+  c.simd.from_utf8_length = &detail::convert_length<utf8, T, errors::strict>;
+  c.scalar.decode = &detail::scalar<T>::decode;
+  c.scalar.encode = &detail::scalar<T>::encode;
+  c.scalar.to_utf8 = &detail::scalar_transcode<T, utf8>::convert;
+  c.scalar.from_utf8 = &detail::scalar_transcode<utf8, T>::convert;
+  c.scalar.decode_length = c.simd.decode_length;
+  c.scalar.encode_length = c.simd.encode_length;
+  c.scalar.to_utf8_length = c.simd.to_utf8_length;
+  c.scalar.from_utf8_length = c.simd.from_utf8_length;
+  return c;
+}
+
+namespace detail {
+
+// lower case without '-' and '_', so utf-8, UTF8 and utf_8 are the same
+inline std::string codec_key(const char* b, const char* e) {
+  std::string k;
+  for (; b < e; ++b) {
+    if (*b != '-' && *b != '_') {
+      k += (*b >= 'A' && *b <= 'Z') ? static_cast<char>(*b - 'A' + 'a') : *b;
+    }
+  }
+  return k;
+}
+
+inline bool codec_matches(const codec& c, const std::string& key) {
+  if (codec_key(c.name, c.name + std::strlen(c.name)) == key) {
+    return true;
+  }
+  for (const char *p = c.aliases; *p != '\0';) {
+    const char *q = p;
+    while (*q != '\0' && *q != ' ') {
+      ++q;
+    }
+    if (q > p && codec_key(p, q) == key) {
+      return true;
+    }
+    p = *q == ' ' ? q + 1 : q;
+  }
+  return false;
+}
+
+struct codec_registry {
+  std::mutex mutex;
+  // a deque keeps the codecs in place as it grows
+  std::deque<codec> codecs;
+
+  codec_registry() {
+    codecs.push_back(make_codec<utf8>("utf-8"));
+    codecs.push_back(make_codec<utf16le>("utf-16le"));
+    codecs.push_back(make_codec<utf16be>("utf-16be"));
+    codecs.push_back(make_codec<utf32le>("utf-32le"));
+    codecs.push_back(make_codec<utf32be>("utf-32be"));
+    codecs.push_back(make_codec<ascii>("ascii", "us-ascii"));
+    codecs.push_back(make_codec<latin1>("iso-8859-1", "latin1 l1"));
+    codecs.push_back(make_codec<iso8859_2>("iso-8859-2", "latin2 l2"));
+    codecs.push_back(make_codec<iso8859_15>("iso-8859-15", "latin9"));
+    codecs.push_back(make_codec<cp1250>("windows-1250", "cp1250"));
+    codecs.push_back(make_codec<cp1251>("windows-1251", "cp1251"));
+    codecs.push_back(make_codec<cp1252>("windows-1252", "cp1252"));
+  }
+
+  static codec_registry& get() {
+    static codec_registry r;
+    return r;
+  }
+};
+
+} // namespace detail
+
+// add a codec, it is found by codec_by_name from then on.
+// a codec registered again under a known name takes over that name.
+inline const codec& register_codec(const codec& c) {
+  detail::codec_registry& r = detail::codec_registry::get();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.codecs.push_back(c);
+  return r.codecs.back();
+}
+
+// nullptr for an unknown name
+inline const codec* codec_by_name(const std::string& name) {
+  std::string key = detail::codec_key(name.data(), name.data() + name.size());
+  detail::codec_registry& r = detail::codec_registry::get();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  // the latest registration of a name wins
+  for (auto it = r.codecs.rbegin(); it != r.codecs.rend(); ++it) {
+    if (detail::codec_matches(*it, key)) {
+      return &*it;
+    }
+  }
+  return nullptr;
+}
+
+inline std::vector<const codec*> codecs() {
+  detail::codec_registry& r = detail::codec_registry::get();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  std::vector<const codec*> v;
+  for (const codec& c : r.codecs) {
+    v.push_back(&c);
+  }
+  return v;
+}
+
+namespace detail {
+
+// same contract as transcode: through utf-8 directly when one side is utf-8,
+// with the transcode kernel of the pair for two built-in utf codecs,
+// otherwise decode a block to uchar and encode it
+inline void convert_codecs(const codec& c1, const codec& c2,
+                           const char*& ib, const char* ie, char*& ob, char* oe) {
+  if (c1.utf8) {
+    c2.simd.from_utf8(ib, ie, ob, oe);
+    return;
+  }
+  if (c2.utf8) {
+    c1.simd.to_utf8(ib, ie, ob, oe);
+    return;
+  }
+  if (c1.utf >= 0 && c2.utf >= 0) {
+    static const codec::convert_fn fns[4][4] = {
+      {&transcode<utf16le, utf16le>::convert, &transcode<utf16le, utf16be>::convert,
+       &transcode<utf16le, utf32le>::convert, &transcode<utf16le, utf32be>::convert},
+      {&transcode<utf16be, utf16le>::convert, &transcode<utf16be, utf16be>::convert,
+       &transcode<utf16be, utf32le>::convert, &transcode<utf16be, utf32be>::convert},
+      {&transcode<utf32le, utf16le>::convert, &transcode<utf32le, utf16be>::convert,
+       &transcode<utf32le, utf32le>::convert, &transcode<utf32le, utf32be>::convert},
+      {&transcode<utf32be, utf16le>::convert, &transcode<utf32be, utf16be>::convert,
+       &transcode<utf32be, utf32le>::convert, &transcode<utf32be, utf32be>::convert},
+    };
+    fns[c1.utf][c2.utf](ib, ie, ob, oe);
+    return;
+  }
+  const codec::kernels& k1 = c1.simd;
+  const codec::kernels& k2 = c2.simd;
+  uchar buff[256];
+  while (ib < ie && ob < oe) {
+    const char *b = ib;
+    uchar *s = buff;
+    k1.decode(b, ie, s, buff + 256);
+    if (s == buff) {
+      break;
+    }
+    const uchar *u = buff;
+    k2.encode(u, s, ob, oe);
+    if (u < s) {
+      // decode again up to where the encoder stopped, to find that place in the input
+      uchar *t = buff;
+      k1.decode(ib, ie, t, buff + (u - buff));
+      break;
+    }
+    ib = b;
+  }
+}
+
+// the length convert_codecs writes for the whole input, up to the first error
+inline std::size_t convert_codecs_length(const codec& c1, const codec& c2, const char*& ib, const char* ie) {
+  if (c1.utf8) {
+    return c2.simd.from_utf8_length(ib, ie);
+  }
+  if (c2.utf8) {
+    return c1.simd.to_utf8_length(ib, ie);
+  }
+  if (c1.utf >= 0 && c2.utf >= 0) {
+    static const codec::decode_length_fn fns[4][4] = {
+      {&convert_length<utf16le, utf16le>, &convert_length<utf16le, utf16be>,
+       &convert_length<utf16le, utf32le>, &convert_length<utf16le, utf32be>},
+      {&convert_length<utf16be, utf16le>, &convert_length<utf16be, utf16be>,
+       &convert_length<utf16be, utf32le>, &convert_length<utf16be, utf32be>},
+      {&convert_length<utf32le, utf16le>, &convert_length<utf32le, utf16be>,
+       &convert_length<utf32le, utf32le>, &convert_length<utf32le, utf32be>},
+      {&convert_length<utf32be, utf16le>, &convert_length<utf32be, utf16be>,
+       &convert_length<utf32be, utf32le>, &convert_length<utf32be, utf32be>},
+    };
+    return fns[c1.utf][c2.utf](ib, ie);
+  }
+  uchar buff[256];
+  std::size_t n = 0;
+  while (ib < ie) {
+    const char *b = ib;
+    uchar *s = buff;
+    c1.simd.decode(b, ie, s, buff + 256);
+    if (s == buff) {
+      break;
+    }
+    const uchar *u = buff;
+    n += c2.simd.encode_length(u, s);
+    if (u < s) {
+      // leave ib where convert_codecs stops
+      uchar *t = buff;
+      c1.simd.decode(ib, ie, t, buff + (u - buff));
+      break;
+    }
+    ib = b;
+  }
+  return n;
+}
+
+// the conversion of codec_transcoder
+struct codec_conv {
+  const codec* from;
+  const codec* to;
+
+  void convert(const char*& ib, const char* ie, char*& ob, char* oe) const {
+    convert_codecs(*from, *to, ib, ie, ob, oe);
+  }
+  bool partial(const char* bs, std::size_t n) const { return from->partial(bs, n); }
+};
+
+} // namespace detail
+
+// the runtime counterparts of encode, decode and convert
+
+template<typename A>
+int encode(const codec& c, str_view ss, sequence<char, A>& bs) {
+  const uchar *sb = ss.data();
+  const uchar *se = ss.limit();
+  std::size_t n = c.simd.encode_length(sb, se);
+  bs.resize(n);
+  sb = ss.data();
+  char *bb = bs.data();
+  c.simd.encode(sb, se, bb, bs.data() + n);
+  return se - sb;
+}
+
+template<typename A>
+int decode(const codec& c, bytes_view bs, sequence<uchar, A>& ss) {
+  const char *bb = bs.data();
+  const char *be = bs.limit();
+  std::size_t n = c.simd.decode_length(bb, be);
+  ss.resize(n);
+  bb = bs.data();
+  uchar *sb = ss.data();
+  c.simd.decode(bb, be, sb, ss.data() + n);
+  return be - bb;
+}
+
+template<typename A>
+int convert(const codec& c1, const codec& c2, bytes_view b1, sequence<char, A>& b2) {
+  if (detail::overlaps(b1.data(), b1.limit(), b2.data(), b2.limit())) {
+    bytes b(b1);
+    return convert(c1, c2, b, b2);
+  }
+  const char *ib = b1.data();
+  const char *ie = b1.limit();
+  std::size_t n = detail::convert_codecs_length(c1, c2, ib, ie);
+  b2.resize(n);
+  ib = b1.data();
+  char *ob = b2.data();
+  detail::convert_codecs(c1, c2, ib, ie, ob, b2.data() + n);
+  return ie - ib;
+}
+
+// transcoder between two runtime codecs
+class codec_transcoder: public basic_transcoder<detail::codec_conv> {
+  typedef basic_transcoder<detail::codec_conv> base;
+public:
+  codec_transcoder(const codec& from, const codec& to):base(detail::codec_conv{&from, &to}){}
+  codec_transcoder(const codec& from, const codec& to, sink_type sink, std::size_t n = 4096)
+    :base(detail::codec_conv{&from, &to}, sink, n){}
+};
 
 } // namespace minicode
 
@@ -0,0 +1,452 @@
+#ifndef _MINICODE_CJK_H_
+#define _MINICODE_CJK_H_ 1
+
+// chinese, japanese and korean legacy codecs: gb18030, gbk, shift_jis and euc_kr.
+// kept apart from minicode.h, the tables in minicode_cjk_tables.h are generated by cjk_gen.py.
+
+#include "minicode.h"
+#include "minicode_cjk_tables.h"
+
+namespace minicode {
+
+///////////////////////////////////////////////////////////////////////////////
+//  multi byte table codecs
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// code point to two byte code, built from the decode cells on first use.
+// one block of 256 codes per used page of the bmp, block 0 stays empty.
+class multi_byte_reverse {
+public:
+  multi_byte_reverse(const std::int16_t* rows, const std::uint16_t* cells, const std::uint8_t* trails, int width)
+      :_index(256, 0),_blocks(256, 0) {
+    for (int lead = 0; lead < 256; ++lead) {
+      if (rows[lead] < 0) {
+        continue;
+      }
+      const std::uint16_t *row = cells + rows[lead] * width;
+      for (int i = 0; i < width; ++i) {
+        std::uint32_t u = row[i];
+        if (u == 0) {
+          continue;
+        }
+        if (_index[u >> 8] == 0) {
+          _index[u >> 8] = static_cast<std::uint16_t>(_blocks.size() / 256);
+          _blocks.resize(_blocks.size() + 256, 0);
+        }
+        _blocks[_index[u >> 8] * 256 + (u & 0xff)] = static_cast<std::uint16_t>(lead << 8 | trails[i]);
+      }
+    }
+  }
+
+  // lead << 8 | trail for code point u, 0 if there is none
+  std::uint32_t get(std::uint32_t u) const {
+    return u < 0x10000 ? _blocks[_index[u >> 8] * 256 + (u & 0xff)] : 0;
+  }
+
+private:
+  std::vector<std::uint16_t> _index;
+  std::vector<std::uint16_t> _blocks;
+};
+
+// a two byte table: rows() gives the row of each lead byte or -1,
+// the trail bytes of a row are [lo, hi] without 0x7f when skip7f is set.
+template<typename Table>
+struct two_byte {
+  static int column(std::uint8_t t) {
+    if (t < Table::lo || t > Table::hi || (Table::skip7f && t == 0x7f)) {
+      return -1;
+    }
+    return t - Table::lo - (Table::skip7f && t > 0x7f);
+  }
+
+  static std::uint32_t decode(std::uint8_t lead, std::uint8_t trail) {
+    int r = Table::rows()[lead];
+    int c = column(trail);
+    return r < 0 || c < 0 ? 0 : Table::cells()[r * Table::width + c];
+  }
+
+  static std::uint32_t encode(std::uint32_t u) {
+    static const multi_byte_reverse r = make();
+    return r.get(u);
+  }
+
+  static multi_byte_reverse make() {
+    std::uint8_t trails[256];
+    for (int t = 0; t < 256; ++t) {
+      int c = column(static_cast<std::uint8_t>(t));
+      if (c >= 0) {
+        trails[c] = static_cast<std::uint8_t>(t);
+      }
+    }
+    return multi_byte_reverse(Table::rows(), Table::cells(), trails, Table::width);
+  }
+};
+
+struct gb18030_table {
+  static const int lo = 0x40, hi = 0xfe, width = 190;
+  static const bool skip7f = true;
+  static const std::int16_t* rows() { return cjk::gb18030_rows(); }
+  static const std::uint16_t* cells() { return cjk::gb18030_cells(); }
+};
+
+struct shift_jis_table {
+  static const int lo = 0x40, hi = 0xfc, width = 188;
+  static const bool skip7f = true;
+  static const std::int16_t* rows() { return cjk::shift_jis_rows(); }
+  static const std::uint16_t* cells() { return cjk::shift_jis_cells(); }
+};
+
+struct euc_kr_table {
+  static const int lo = 0xa1, hi = 0xfe, width = 94;
+  static const bool skip7f = false;
+  static const std::int16_t* rows() { return cjk::euc_kr_rows(); }
+  static const std::uint16_t* cells() { return cjk::euc_kr_cells(); }
+};
+
+// base of the ascii compatible multi byte codecs,
+// Codec::incomplete(bs, n) tells if [bs, bs + n) is a sequence cut short
+template<typename Codec>
+struct multi_byte {};
+
+inline int put2(char* bs, int n, std::uint32_t c) {
+  if (n < 2) {
+    return -1;
+  }
+  bs[0] = static_cast<char>(c >> 8);
+  bs[1] = static_cast<char>(c & 0xff);
+  return 2;
+}
+
+inline bool gbk_has(std::uint8_t lead, std::uint8_t trail) {
+  std::size_t i = gb18030_table::rows()[lead] * gb18030_table::width + two_byte<gb18030_table>::column(trail);
+  return (cjk::gbk_bits()[i / 32] >> (i % 32)) & 1;
+}
+
+} // namespace detail
+
+
+// gb18030: ascii, two byte codes from the table,
+// and four byte codes computed from ranges for the rest of unicode
+struct gb18030: detail::multi_byte<gb18030> {
+  typedef detail::two_byte<detail::gb18030_table> table;
+
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(bs);
+    if (b[0] < 0x80) {
+      uc.value() = b[0];
+      return 1;
+    }
+    if (b[0] == 0x80 || b[0] == 0xff || n < 2) {
+      return -1;
+    }
+    if (b[1] >= 0x30 && b[1] <= 0x39) {
+      if (n < 4 || b[2] < 0x81 || b[2] > 0xfe || b[3] < 0x30 || b[3] > 0x39) {
+        return -1;
+      }
+      std::uint32_t i = (((b[0] - 0x81) * 10 + (b[1] - 0x30)) * 126 + (b[2] - 0x81)) * 10 + (b[3] - 0x30);
+      std::uint32_t u = from_index(i);
+      if (u == 0) {
+        return -1;
+      }
+      uc.value() = u;
+      return 4;
+    }
+    std::uint32_t u = table::decode(b[0], b[1]);
+    if (u == 0) {
+      return -1;
+    }
+    uc.value() = u;
+    return 2;
+  }
+
+  int operator()(const uchar uc, char *bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    if (u < 0x80) {
+      bs[0] = static_cast<char>(u);
+      return 1;
+    }
+    if (!is_valid_unicode(u)) {
+      return -1;
+    }
+    std::uint32_t c = table::encode(u);
+    if (c != 0) {
+      return detail::put2(bs, n, c);
+    }
+    std::uint32_t i = to_index(u);
+    if (i == 0xffffffff || n < 4) {
+      return -1;
+    }
+    bs[3] = static_cast<char>(0x30 + i % 10);
+    i /= 10;
+    bs[2] = static_cast<char>(0x81 + i % 126);
+    i /= 126;
+    bs[1] = static_cast<char>(0x30 + i % 10);
+    bs[0] = static_cast<char>(0x81 + i / 10);
+    return 4;
+  }
+
+  static bool incomplete(const char* bs, std::size_t n) {
+    const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(bs);
+    if (b[0] < 0x81 || b[0] > 0xfe) {
+      return false;
+    }
+    return n == 1 || (n < 4 && b[1] >= 0x30 && b[1] <= 0x39 && (n == 2 || (b[2] >= 0x81 && b[2] <= 0xfe)));
+  }
+
+private:
+  // linear index of a four byte code, 0 if it maps to nothing
+  static std::uint32_t from_index(std::uint32_t i) {
+    const std::uint32_t *index = detail::cjk::gb18030_range_index();
+    const std::uint32_t *code = detail::cjk::gb18030_range_code();
+    const int count = detail::cjk::gb18030_range_count;
+    if (i < index[count]) {
+      int k = std::upper_bound(index, index + count, i) - index - 1;
+      return code[k] + (i - index[k]);
+    }
+    if (i >= 189000 && i < 189000 + 0x100000) {
+      return 0x10000 + (i - 189000);
+    }
+    return 0;
+  }
+
+  static std::uint32_t to_index(std::uint32_t u) {
+    if (u >= 0x10000) {
+      return 189000 + (u - 0x10000);
+    }
+    const std::uint32_t *index = detail::cjk::gb18030_range_index();
+    const std::uint32_t *code = detail::cjk::gb18030_range_code();
+    const int count = detail::cjk::gb18030_range_count;
+    int k = std::upper_bound(code, code + count, u) - code - 1;
+    if (k < 0 || index[k] + (u - code[k]) >= index[k + 1]) {
+      return 0xffffffff;
+    }
+    return index[k] + (u - code[k]);
+  }
+};
+
+// gbk: the two byte part of gb18030 without its later additions
+struct gbk: detail::multi_byte<gbk> {
+  typedef detail::two_byte<detail::gb18030_table> table;
+
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(bs);
+    if (b[0] < 0x80) {
+      uc.value() = b[0];
+      return 1;
+    }
+    if (n < 2) {
+      return -1;
+    }
+    std::uint32_t u = table::decode(b[0], b[1]);
+    if (u == 0 || !detail::gbk_has(b[0], b[1])) {
+      return -1;
+    }
+    uc.value() = u;
+    return 2;
+  }
+
+  int operator()(const uchar uc, char *bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    if (u < 0x80) {
+      bs[0] = static_cast<char>(u);
+      return 1;
+    }
+    std::uint32_t c = table::encode(u);
+    if (c == 0 || !detail::gbk_has(c >> 8, c & 0xff)) {
+      return -1;
+    }
+    return detail::put2(bs, n, c);
+  }
+
+  static bool incomplete(const char* bs, std::size_t n) {
+    const std::uint8_t b = static_cast<std::uint8_t>(bs[0]);
+    return n == 1 && b >= 0x81 && b <= 0xfe;
+  }
+};
+
+// shift_jis: ascii, half-width katakana in 0xa1-0xdf and jis x 0208 in two bytes
+struct shift_jis: detail::multi_byte<shift_jis> {
+  typedef detail::two_byte<detail::shift_jis_table> table;
+
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(bs);
+    if (b[0] < 0x80) {
+      uc.value() = b[0];
+      return 1;
+    }
+    if (b[0] >= 0xa1 && b[0] <= 0xdf) {
+      uc.value() = 0xff61 + (b[0] - 0xa1);
+      return 1;
+    }
+    if (n < 2) {
+      return -1;
+    }
+    std::uint32_t u = table::decode(b[0], b[1]);
+    if (u == 0) {
+      return -1;
+    }
+    uc.value() = u;
+    return 2;
+  }
+
+  int operator()(const uchar uc, char *bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    if (u < 0x80) {
+      bs[0] = static_cast<char>(u);
+      return 1;
+    }
+    if (u >= 0xff61 && u <= 0xff9f) {
+      bs[0] = static_cast<char>(0xa1 + (u - 0xff61));
+      return 1;
+    }
+    std::uint32_t c = table::encode(u);
+    return c == 0 ? -1 : detail::put2(bs, n, c);
+  }
+
+  static bool incomplete(const char* bs, std::size_t n) {
+    const std::uint8_t b = static_cast<std::uint8_t>(bs[0]);
+    return n == 1 && ((b >= 0x81 && b <= 0x9f) || (b >= 0xe0 && b <= 0xfc));
+  }
+};
+
+// euc_kr: ascii and ks x 1001 in two bytes.
+// hangul outside ks x 1001 is not encoded, there are no eight byte jamo sequences.
+struct euc_kr: detail::multi_byte<euc_kr> {
+  typedef detail::two_byte<detail::euc_kr_table> table;
+
+  int operator()(const char *bs, int n, uchar& uc) {
+    assert(n > 0);
+    const std::uint8_t *b = reinterpret_cast<const std::uint8_t*>(bs);
+    if (b[0] < 0x80) {
+      uc.value() = b[0];
+      return 1;
+    }
+    if (n < 2) {
+      return -1;
+    }
+    std::uint32_t u = table::decode(b[0], b[1]);
+    if (u == 0) {
+      return -1;
+    }
+    uc.value() = u;
+    return 2;
+  }
+
+  int operator()(const uchar uc, char *bs, int n) {
+    assert(n > 0);
+    const std::uint32_t u = uc.value();
+    if (u < 0x80) {
+      bs[0] = static_cast<char>(u);
+      return 1;
+    }
+    std::uint32_t c = table::encode(u);
+    return c == 0 ? -1 : detail::put2(bs, n, c);
+  }
+
+  static bool incomplete(const char* bs, std::size_t n) {
+    const std::uint8_t b = static_cast<std::uint8_t>(bs[0]);
+    return n == 1 && b >= 0xa1 && b <= 0xfe;
+  }
+};
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  bulk kernels of the multi byte codecs
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+template<typename T>
+struct utf_traits<T, typename std::enable_if<std::is_base_of<multi_byte<T>, T>::value>::type> {
+  static const int bits = 2;
+  static const bool big = false;
+};
+
+template<typename T>
+struct partial<T, 2> {
+  static bool test(const char* bs, std::size_t n) { return T::incomplete(bs, n); }
+};
+
+// ascii runs go through the simd helpers, the rest through the functor
+template<typename T>
+struct bulk<T, typename std::enable_if<utf_traits<T>::bits == 2>::type> {
+  static void decode(const char*& bb, const char* be, uchar*& sb, uchar* se) {
+    T t;
+    while (bb < be && sb < se) {
+      decode_ascii(bb, be, sb, se);
+      while (bb < be && sb < se && static_cast<std::uint8_t>(*bb) >= 0x80) {
+        int p = t(bb, clamp_len(be - bb), *sb);
+        if (p < 0) {
+          return;
+        }
+        bb += p;
+        ++sb;
+      }
+    }
+  }
+
+  static void encode(const uchar*& sb, const uchar* se, char*& bb, char* be) {
+    T t;
+    while (sb < se && bb < be) {
+      encode_ascii(sb, se, bb, be);
+      while (sb < se && bb < be && sb->value() >= 0x80) {
+        int p = t(*sb, bb, clamp_len(be - bb));
+        if (p < 0) {
+          return;
+        }
+        ++sb;
+        bb += p;
+      }
+    }
+  }
+};
+
+template<typename T1, typename T2>
+struct transcode<T1, T2, 2, 8> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+      copy_ascii(ib, ie, ob, oe);
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+template<typename T1, typename T2>
+struct transcode<T1, T2, 8, 2> {
+  static void convert(const char*& ib, const char* ie, char*& ob, char* oe) {
+    while (ib < ie && ob < oe) {
+      copy_ascii(ib, ie, ob, oe);
+      if (!transcode_one<T1, T2>(ib, ie, ob, oe)) {
+        break;
+      }
+    }
+  }
+};
+
+} // namespace detail
+
+// make these codecs known to codec_by_name, only the first call registers them
+inline void register_cjk_codecs() {
+  static const bool done = [] {
+    register_codec(make_codec<gb18030>("gb18030"));
+    register_codec(make_codec<gbk>("gbk"));
+    register_codec(make_codec<shift_jis>("shift_jis", "sjis"));
+    register_codec(make_codec<euc_kr>("euc-kr"));
+    return true;
+  }();
+  (void)done;
+}
+
+} // namespace minicode
+
+#endif // _MINICODE_CJK_H_
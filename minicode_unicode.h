@@ -0,0 +1,185 @@
+#ifndef _MINICODE_UNICODE_H_
+#define _MINICODE_UNICODE_H_ 1
+
+// unicode character properties: general category, the predicates of python's str and display width.
+// kept apart from minicode.h, the tables in minicode_unicode_tables.h are generated by unicode_gen.py.
+
+#include "minicode.h"
+#include "minicode_unicode_tables.h"
+
+namespace minicode {
+
+///////////////////////////////////////////////////////////////////////////////
+//  character properties
+///////////////////////////////////////////////////////////////////////////////
+
+// in the order of unicode_gen.py, the names are the two letter aliases
+enum class general_category : std::uint8_t {
+  lu, ll, lt, lm, lo, mn, mc, me, nd, nl, no,
+  pc, pd, ps, pe, pi, pf, po, sm, sc, sk, so,
+  zs, zl, zp, cc, cf, cs, co, cn
+};
+
+namespace detail {
+namespace props {
+
+enum { space = 1, alpha = 2, decimal = 4, digit = 8, numeric = 16, printable = 32 };
+
+// a three stage trie, ascii straight from its own table.
+// past 0x10ffff is taken as unassigned.
+inline std::uint16_t lookup(std::uint32_t u) {
+  if (u < 0x80) {
+    return records()[ascii()[u]];
+  }
+  if (u > 0x10ffff) {
+    u = 0x10ffff;
+  }
+  std::uint32_t i = top()[u >> shift1];
+  i = mid()[(i << (shift1 - shift2)) + ((u >> shift2) & ((1u << (shift1 - shift2)) - 1))];
+  return records()[leaf()[(i << shift2) + (u & ((1u << shift2) - 1))]];
+}
+
+inline bool has(uchar c, int flag) {
+  return ((lookup(c.value()) >> 7) & flag) != 0;
+}
+
+// true if every character has the flag and there is one at least
+inline bool all(str_view s, int flag) {
+  for (std::size_t i = 0; i < s.size(); ++i) {
+    if (!has(s[i], flag)) {
+      return false;
+    }
+  }
+  return s.size() > 0;
+}
+
+} // namespace props
+} // namespace detail
+
+inline general_category category(uchar c) {
+  return static_cast<general_category>(detail::props::lookup(c.value()) & 0x1f);
+}
+
+// "Lu" to "Cn", as unicodedata.category gives it
+inline const char* category_name(general_category g) {
+  static const char* const names[] = {
+    "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No",
+    "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So",
+    "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co", "Cn"
+  };
+  return names[static_cast<int>(g)];
+}
+
+// the same as the str methods of python, for one character
+
+inline bool isspace(uchar c) { return detail::props::has(c, detail::props::space); }
+inline bool isalpha(uchar c) { return detail::props::has(c, detail::props::alpha); }
+inline bool isdecimal(uchar c) { return detail::props::has(c, detail::props::decimal); }
+inline bool isdigit(uchar c) { return detail::props::has(c, detail::props::digit); }
+inline bool isnumeric(uchar c) { return detail::props::has(c, detail::props::numeric); }
+inline bool isprintable(uchar c) { return detail::props::has(c, detail::props::printable); }
+
+inline bool isalnum(uchar c) {
+  return detail::props::has(c, detail::props::alpha | detail::props::decimal |
+                               detail::props::digit | detail::props::numeric);
+}
+
+// and for a whole string, false if it is empty, except that isprintable is true then
+
+inline bool isspace(str_view s) { return detail::props::all(s, detail::props::space); }
+inline bool isalpha(str_view s) { return detail::props::all(s, detail::props::alpha); }
+inline bool isdecimal(str_view s) { return detail::props::all(s, detail::props::decimal); }
+inline bool isdigit(str_view s) { return detail::props::all(s, detail::props::digit); }
+inline bool isnumeric(str_view s) { return detail::props::all(s, detail::props::numeric); }
+inline bool isprintable(str_view s) { return s.size() == 0 || detail::props::all(s, detail::props::printable); }
+
+inline bool isalnum(str_view s) {
+  for (std::size_t i = 0; i < s.size(); ++i) {
+    if (!isalnum(s[i])) {
+      return false;
+    }
+  }
+  return s.size() > 0;
+}
+
+// columns on a terminal: 2 for wide and fullwidth east asian characters,
+// 0 for combining marks, format and control characters, 1 for the rest.
+inline int display_width(uchar c) {
+  return (detail::props::lookup(c.value()) >> 5) & 3;
+}
+
+inline std::size_t display_width(str_view s) {
+  const uchar *p = s.data();
+  const uchar *e = s.limit();
+  std::size_t n = 0;
+  while (p < e) {
+#if defined(MINICODE_SSE2)
+    // four at a time while they are all printable ascii, or all cjk ideographs or hangul syllables
+    while (e - p >= 4) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      __m128i narrow = _mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(0x1f)),
+                                     _mm_cmplt_epi32(v, _mm_set1_epi32(0x7f)));
+      if (_mm_movemask_epi8(narrow) == 0xffff) {
+        n += 4;
+        p += 4;
+        continue;
+      }
+      __m128i wide = _mm_or_si128(_mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(0x4dff)),
+                                                _mm_cmplt_epi32(v, _mm_set1_epi32(0xa000))),
+                                  _mm_and_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(0xabff)),
+                                                _mm_cmplt_epi32(v, _mm_set1_epi32(0xd7a4))));
+      if (_mm_movemask_epi8(wide) == 0xffff) {
+        n += 8;
+        p += 4;
+        continue;
+      }
+      break;
+    }
+    if (p == e) {
+      break;
+    }
+#endif
+    n += display_width(*p++);
+  }
+  return n;
+}
+
+// of encoded text, up to the first error
+template<typename T>
+std::size_t display_width(bytes_view bs) {
+  const char *b = bs.data();
+  const char *e = bs.limit();
+  std::size_t n = 0;
+  while (b < e) {
+#if defined(MINICODE_SSE2)
+    if (detail::utf_traits<T>::bits == 8 && static_cast<std::uint8_t>(*b) < 0x80) {
+      // printable ascii sixteen at a time
+      while (e - b >= 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+        __m128i narrow = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(0x1f)),
+                                       _mm_cmplt_epi8(v, _mm_set1_epi8(0x7f)));
+        if (_mm_movemask_epi8(narrow) != 0xffff) {
+          break;
+        }
+        n += 16;
+        b += 16;
+      }
+      if (b == e) {
+        break;
+      }
+    }
+#endif
+    uchar u;
+    int p = T()(b, detail::clamp_len(e - b), u);
+    if (p <= 0) {
+      break;
+    }
+    n += display_width(u);
+    b += p;
+  }
+  return n;
+}
+
+} // namespace minicode
+
+#endif // _MINICODE_UNICODE_H_
@@ -0,0 +1,851 @@
+// generated by unicode_gen.py from the Python unicodedata, do not edit
+
+#ifndef _MINICODE_UNICODE_TABLES_H_
+#define _MINICODE_UNICODE_TABLES_H_ 1
+
+#include <cstdint>
+
+namespace minicode {
+namespace detail {
+namespace props {
+
+const char* const unicode_version = "14.0.0";
+
+// record of u is records()[leaf()[(mid()[(top()[u >> shift1] << (shift1 - shift2)) +
+//   ((u >> shift2) & ((1 << (shift1 - shift2)) - 1))] << shift2) + (u & ((1 << shift2) - 1))]],
+// 22972 bytes in all
+const int shift1 = 9;
+const int shift2 = 4;
+
+// category, then width << 5, then flags << 7: space, alpha, decimal, digit, numeric, printable
+inline const std::uint16_t* records() {
+  static const std::uint16_t t[54] = {
+    25, 153, 4278, 4145, 4147, 4141, 4142, 4146, 4140, 7720, 4384, 4148,
+    4139, 4385, 182, 4149, 4388, 4143, 58, 7210, 4144, 6186, 4386, 4387,
+    4101, 93, 4103, 26, 4134, 4420, 4356, 6185, 151, 152, 4181, 4173,
+    4174, 4178, 214, 4177, 4419, 6217, 4172, 4166, 4180, 6218, 6468, 59,
+    60, 4171, 4179, 7752, 4416, 4417,
+  };
+  return t;
+}
+
+// record of each ascii code point, without the trie
+inline const std::uint8_t* ascii() {
+  static const std::uint8_t t[128] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    2, 3, 3, 3, 4, 3, 3, 3, 5, 6, 3, 7, 3, 8, 3, 3,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 7, 7, 7, 3,
+    3, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 3, 6, 11, 12,
+    11, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 5, 7, 6, 7, 0,
+  };
+  return t;
+}
+
+// mid block of each range of 1 << shift1
+inline const std::uint8_t* top() {
+  static const std::uint8_t t[2176] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 27, 27,
+    27, 27, 27, 27, 27, 27, 30, 31, 32, 33, 27, 34, 35, 27, 27, 36,
+    27, 37, 27, 38, 27, 27, 27, 39, 27, 40, 27, 41, 27, 27, 27, 27,
+    42, 27, 43, 27, 27, 27, 44, 27, 27, 27, 27, 45, 27, 27, 27, 27,
+    46, 27, 47, 48, 49, 50, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 51, 52, 52, 52, 52,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 54, 55, 56, 57,
+    58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+    74, 75, 76, 77, 77, 77, 77, 78, 74, 74, 79, 77, 77, 77, 77, 77,
+    77, 77, 74, 80, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 74, 81, 77, 82, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 83, 27, 27, 84, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 85, 86, 87, 77, 77, 77, 77, 88, 77,
+    77, 77, 77, 77, 77, 77, 77, 89, 90, 91, 92, 93, 94, 95, 77, 96,
+    97, 98, 77, 99, 100, 77, 101, 102, 103, 104, 105, 106, 107, 108, 77, 77,
+    109, 27, 27, 27, 110, 111, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 112, 27, 27, 113, 27, 27, 27, 27, 27, 27, 27, 27, 114, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 115, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 116, 27, 27, 27, 27, 27, 27, 27, 117, 118, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 119, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 120, 77, 77, 77, 77, 77, 77, 121, 122, 77, 77,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 123, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    124, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 125,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 125,
+  };
+  return t;
+}
+
+// leaf block of each range of 1 << shift2
+inline const std::uint16_t* mid() {
+  static const std::uint16_t t[4032] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 16, 16, 17, 18, 16, 16, 19, 20, 21, 22, 23, 24, 25, 16, 26,
+    16, 16, 16, 27, 28, 14, 14, 14, 14, 29, 14, 30, 31, 32, 33, 34,
+    35, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39, 14, 40, 41, 16, 42,
+    12, 12, 12, 14, 14, 14, 16, 16, 43, 16, 16, 16, 44, 16, 16, 16,
+    16, 16, 16, 45, 12, 46, 14, 14, 47, 48, 35, 49, 50, 51, 52, 53,
+    54, 55, 51, 51, 56, 35, 57, 58, 51, 51, 51, 51, 51, 59, 60, 61,
+    62, 63, 51, 35, 64, 51, 51, 51, 51, 51, 65, 66, 67, 51, 68, 69,
+    51, 70, 71, 72, 51, 73, 74, 51, 75, 76, 51, 51, 77, 35, 78, 35,
+    79, 51, 51, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92,
+    93, 86, 87, 94, 95, 96, 97, 98, 99, 100, 87, 101, 102, 103, 91, 104,
+    105, 86, 87, 106, 107, 108, 91, 109, 110, 111, 112, 113, 114, 115, 97, 116,
+    117, 118, 87, 119, 120, 121, 91, 122, 123, 118, 87, 124, 125, 126, 91, 127,
+    128, 118, 51, 129, 130, 131, 91, 132, 133, 134, 51, 135, 136, 137, 97, 138,
+    139, 51, 51, 140, 141, 142, 143, 143, 144, 51, 145, 146, 147, 148, 143, 143,
+    149, 150, 151, 152, 153, 51, 154, 155, 156, 157, 35, 158, 159, 160, 143, 143,
+    51, 51, 161, 162, 163, 164, 165, 166, 167, 168, 12, 12, 169, 14, 14, 170,
+    171, 171, 171, 171, 171, 171, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+    51, 51, 51, 51, 173, 174, 51, 51, 173, 51, 51, 175, 176, 177, 51, 51,
+    51, 176, 51, 51, 51, 178, 179, 180, 51, 181, 12, 12, 12, 12, 12, 182,
+    183, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 184, 51, 185, 186, 51, 51, 51, 51, 187, 188,
+    51, 189, 51, 190, 51, 191, 192, 193, 51, 51, 51, 194, 195, 196, 197, 198,
+    199, 197, 51, 51, 200, 51, 51, 201, 202, 51, 203, 51, 51, 51, 51, 204,
+    51, 205, 206, 207, 208, 51, 209, 210, 51, 51, 211, 51, 212, 213, 214, 214,
+    51, 215, 51, 51, 51, 216, 217, 218, 197, 197, 219, 220, 221, 143, 143, 143,
+    222, 51, 51, 223, 224, 163, 225, 226, 227, 51, 228, 67, 51, 51, 229, 230,
+    51, 51, 231, 232, 233, 67, 51, 234, 235, 12, 12, 236, 237, 238, 239, 240,
+    14, 14, 241, 30, 30, 30, 242, 243, 14, 244, 30, 30, 35, 35, 35, 35,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 245, 16, 16, 16, 16, 16, 16,
+    246, 247, 246, 246, 247, 248, 246, 249, 250, 250, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 266, 267, 268, 269, 270,
+    271, 272, 273, 274, 275, 276, 277, 277, 278, 279, 280, 214, 281, 282, 214, 283,
+    284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284,
+    285, 286, 287, 214, 214, 214, 214, 288, 214, 289, 284, 290, 214, 291, 292, 293,
+    214, 214, 294, 143, 295, 143, 296, 297, 298, 299, 214, 214, 214, 214, 300, 301,
+    214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 302, 303, 214, 214, 304,
+    214, 305, 214, 214, 306, 307, 308, 309, 214, 310, 311, 312, 313, 314, 315, 316,
+    317, 214, 318, 214, 319, 320, 321, 322, 323, 324, 214, 325, 326, 284, 327, 284,
+    214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+    284, 284, 284, 284, 284, 284, 284, 284, 328, 329, 284, 284, 284, 330, 284, 331,
+    284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284,
+    214, 332, 214, 284, 333, 334, 214, 335, 214, 336, 214, 214, 214, 214, 214, 214,
+    12, 12, 12, 14, 14, 14, 337, 338, 16, 16, 16, 16, 16, 16, 339, 340,
+    14, 14, 341, 51, 51, 51, 342, 343, 51, 344, 345, 345, 345, 345, 35, 35,
+    346, 347, 348, 349, 350, 351, 143, 143, 352, 353, 352, 352, 352, 352, 352, 354,
+    352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 355, 143, 356,
+    357, 358, 359, 360, 361, 171, 171, 171, 171, 362, 363, 171, 171, 171, 171, 364,
+    365, 171, 171, 361, 171, 171, 171, 171, 366, 367, 171, 171, 352, 352, 354, 171,
+    352, 368, 369, 352, 370, 371, 352, 352, 369, 352, 352, 371, 352, 352, 352, 352,
+    352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+    372, 171, 171, 171, 171, 171, 171, 171, 373, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 374, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 375, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 214, 214, 214, 214,
+    376, 171, 171, 171, 171, 375, 171, 171, 377, 378, 171, 379, 380, 379, 381, 171,
+    375, 171, 171, 171, 171, 171, 171, 380, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    382, 171, 171, 171, 383, 171, 384, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 385, 171, 171, 171, 171, 171, 171, 171, 386, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 387, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 388,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 374, 171, 171, 171, 171, 171, 171, 171, 389,
+    390, 380, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 391,
+    171, 171, 171, 171, 377, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 392, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    383, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 383, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 391, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 383, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 377, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 391, 373, 171, 171, 171, 171,
+    171, 171, 171, 380, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 393, 171, 394, 171, 171, 381, 171, 171, 171, 171, 171, 171, 171, 383,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 395, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 396, 352, 352, 352, 397, 51, 51, 234,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    398, 51, 399, 143, 16, 16, 400, 401, 16, 402, 51, 51, 51, 51, 403, 404,
+    34, 405, 406, 407, 16, 16, 16, 408, 409, 410, 411, 412, 413, 414, 143, 415,
+    416, 51, 417, 418, 51, 51, 51, 419, 420, 51, 51, 421, 422, 197, 35, 423,
+    67, 51, 424, 51, 425, 426, 171, 396, 79, 51, 51, 427, 428, 429, 430, 431,
+    51, 51, 432, 433, 434, 435, 51, 436, 51, 51, 51, 437, 438, 439, 440, 441,
+    442, 443, 345, 14, 14, 444, 445, 14, 14, 14, 14, 14, 51, 51, 446, 197,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 447, 51, 448, 51, 51, 211,
+    449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449,
+    449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+    171, 171, 171, 171, 171, 171, 387, 451, 171, 171, 171, 392, 171, 452, 171, 375,
+    171, 171, 171, 171, 171, 171, 453, 171, 171, 171, 171, 171, 171, 454, 143, 143,
+    455, 456, 457, 458, 459, 51, 51, 51, 51, 51, 51, 460, 461, 462, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 463, 214, 51, 51, 51, 51, 464, 51, 51, 465, 143, 143, 466,
+    35, 467, 35, 468, 469, 470, 471, 472, 51, 51, 51, 51, 51, 51, 51, 473,
+    474, 475, 476, 477, 478, 479, 480, 481, 51, 482, 51, 205, 483, 484, 485, 486,
+    487, 51, 177, 488, 209, 209, 143, 143, 51, 51, 51, 51, 51, 51, 51, 74,
+    489, 276, 276, 490, 277, 277, 277, 491, 492, 493, 494, 143, 143, 214, 214, 495,
+    143, 143, 143, 143, 143, 143, 143, 143, 51, 154, 51, 51, 51, 103, 496, 497,
+    51, 51, 498, 51, 499, 51, 51, 500, 51, 501, 51, 51, 502, 503, 143, 143,
+    12, 12, 504, 14, 14, 51, 51, 51, 51, 209, 197, 12, 12, 505, 14, 506,
+    51, 51, 507, 51, 51, 51, 508, 509, 509, 510, 511, 512, 143, 143, 143, 143,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 344, 51, 204, 507, 143, 513, 30, 30, 514, 143, 143, 143, 143,
+    515, 51, 51, 516, 51, 517, 51, 518, 51, 205, 519, 143, 143, 143, 51, 520,
+    51, 521, 51, 522, 143, 143, 143, 143, 51, 51, 51, 523, 276, 524, 276, 276,
+    525, 526, 51, 527, 528, 529, 51, 530, 51, 531, 143, 143, 532, 51, 533, 534,
+    51, 51, 51, 535, 51, 536, 51, 537, 51, 538, 539, 143, 143, 143, 143, 143,
+    51, 51, 51, 51, 201, 143, 143, 143, 12, 12, 12, 540, 14, 14, 14, 541,
+    51, 51, 542, 197, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 296, 543, 51, 51, 544, 545, 143, 143, 143, 143,
+    51, 531, 546, 51, 65, 547, 143, 51, 548, 143, 143, 51, 549, 143, 51, 344,
+    550, 51, 51, 551, 552, 553, 554, 555, 227, 51, 51, 556, 557, 51, 201, 197,
+    558, 51, 559, 560, 561, 51, 51, 562, 227, 51, 51, 563, 564, 565, 566, 567,
+    51, 100, 568, 569, 143, 143, 143, 143, 570, 571, 572, 51, 51, 573, 574, 197,
+    575, 86, 87, 576, 577, 578, 579, 580, 143, 143, 143, 143, 143, 143, 143, 143,
+    51, 51, 51, 581, 582, 583, 545, 143, 51, 51, 51, 584, 585, 197, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 51, 51, 586, 587, 588, 589, 143, 143,
+    51, 51, 51, 590, 591, 197, 592, 143, 51, 51, 593, 594, 197, 143, 143, 143,
+    51, 178, 595, 596, 344, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    51, 51, 568, 597, 143, 143, 143, 143, 143, 143, 12, 12, 14, 14, 151, 598,
+    599, 600, 51, 601, 602, 197, 143, 143, 143, 143, 603, 51, 51, 604, 605, 143,
+    606, 51, 51, 607, 608, 609, 51, 51, 610, 611, 612, 51, 51, 51, 51, 201,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    87, 51, 586, 613, 614, 151, 615, 616, 51, 617, 618, 619, 143, 143, 143, 143,
+    620, 51, 51, 621, 622, 197, 623, 51, 624, 625, 197, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 51, 626,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 103, 276, 627, 628, 629,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 212, 143, 143, 143, 143, 143, 143,
+    277, 277, 277, 277, 277, 277, 630, 631, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 632, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 51, 51, 51, 51, 51, 51, 633,
+    51, 51, 205, 634, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    51, 51, 51, 51, 344, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    51, 51, 51, 201, 51, 205, 429, 51, 51, 51, 51, 205, 197, 51, 209, 635,
+    51, 51, 51, 636, 637, 638, 639, 640, 51, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 12, 12, 14, 14, 276, 641, 143, 143, 143, 143, 143, 143,
+    51, 51, 51, 51, 642, 643, 644, 644, 645, 646, 143, 143, 143, 143, 647, 648,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 649,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 650, 143, 143,
+    651, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 652,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 653, 143, 143, 653, 654, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 655,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    51, 51, 51, 51, 51, 51, 74, 154, 201, 656, 657, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    35, 35, 658, 35, 659, 214, 214, 214, 214, 214, 214, 214, 660, 143, 143, 143,
+    214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 661,
+    214, 214, 662, 214, 214, 214, 663, 664, 665, 214, 666, 214, 214, 214, 295, 143,
+    214, 214, 214, 214, 667, 143, 143, 143, 143, 143, 143, 143, 143, 143, 276, 668,
+    214, 214, 214, 214, 214, 294, 276, 669, 143, 143, 143, 143, 143, 143, 143, 143,
+    12, 670, 14, 671, 672, 673, 246, 12, 674, 675, 676, 677, 678, 12, 670, 14,
+    679, 680, 14, 681, 682, 683, 684, 12, 685, 14, 12, 670, 14, 671, 672, 14,
+    246, 12, 674, 684, 12, 685, 14, 12, 670, 14, 686, 12, 687, 688, 689, 690,
+    14, 691, 12, 692, 693, 694, 695, 14, 696, 12, 697, 14, 698, 699, 699, 699,
+    214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+    214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+    35, 35, 35, 700, 35, 35, 701, 702, 703, 704, 48, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    705, 706, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    707, 708, 709, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    51, 51, 154, 710, 711, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 51, 712, 143, 51, 51, 713, 714,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 715, 205,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 716, 659, 143, 143,
+    12, 12, 674, 14, 717, 429, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 566, 276, 276, 718, 719, 143, 143, 143, 143,
+    566, 276, 720, 721, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    722, 51, 723, 724, 725, 726, 727, 728, 729, 211, 730, 211, 143, 143, 143, 731,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    314, 214, 732, 214, 214, 214, 214, 214, 214, 660, 733, 734, 735, 734, 214, 661,
+    736, 214, 214, 214, 214, 214, 214, 214, 737, 738, 739, 143, 143, 143, 740, 214,
+    741, 352, 352, 356, 742, 743, 355, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    352, 352, 744, 745, 352, 352, 352, 746, 352, 307, 352, 352, 747, 307, 352, 748,
+    352, 352, 352, 749, 750, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 751,
+    352, 352, 352, 752, 753, 352, 754, 315, 214, 755, 314, 214, 214, 214, 214, 756,
+    352, 352, 352, 352, 352, 214, 214, 214, 352, 352, 352, 352, 757, 758, 759, 760,
+    214, 214, 214, 214, 214, 214, 214, 660, 214, 214, 214, 214, 214, 761, 356, 762,
+    732, 214, 214, 214, 763, 181, 214, 214, 763, 214, 739, 764, 143, 143, 143, 143,
+    765, 352, 352, 766, 745, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+    214, 214, 214, 214, 214, 660, 739, 767, 397, 352, 768, 769, 355, 770, 771, 397,
+    214, 214, 214, 214, 214, 214, 214, 214, 214, 772, 214, 214, 295, 143, 143, 197,
+    393, 171, 171, 171, 171, 171, 382, 171, 171, 171, 171, 171, 171, 171, 392, 171,
+    171, 171, 393, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 374, 171, 171, 171, 171, 171, 773, 377, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 374, 375,
+    171, 774, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 380, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 381, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 387, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 375, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 143, 143,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 651, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 453, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 775, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 776, 143,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 380, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 453, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+    171, 171, 171, 171, 777, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+    778, 143, 779, 779, 779, 779, 779, 779, 143, 143, 143, 143, 143, 143, 143, 143,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 143,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+    450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450, 780,
+  };
+  return t;
+}
+
+// record of each code point
+inline const std::uint8_t* leaf() {
+  static const std::uint8_t t[12496] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    2, 3, 3, 3, 4, 3, 3, 3, 5, 6, 3, 7, 3, 8, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 7, 7, 7, 3,
+    3, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 3, 6, 11, 12,
+    11, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 5, 7, 6, 7, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 3, 4, 4, 4, 4, 15, 3, 11, 15, 16, 17, 7, 18, 15, 11, 15, 7, 19, 19, 11, 13, 3, 3, 11, 19, 16, 20, 21, 21, 21, 3,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 7, 10, 10, 10, 10, 10, 10, 10, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 7, 13, 13, 13, 13, 13, 13, 13, 13,
+    10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 10, 13, 10, 13, 10, 13, 10,
+    13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 10, 13, 10, 13, 10, 13, 13,
+    13, 10, 10, 13, 10, 13, 10, 10, 13, 10, 10, 10, 13, 13, 10, 10, 10, 10, 13, 10, 10, 13, 10, 10, 10, 13, 13, 13, 10, 10, 13, 10,
+    10, 13, 10, 13, 10, 13, 10, 10, 13, 10, 13, 13, 10, 13, 10, 10, 13, 10, 10, 10, 13, 10, 13, 10, 10, 13, 13, 16, 10, 13, 13, 13,
+    16, 16, 16, 16, 10, 22, 13, 10, 22, 13, 10, 22, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 10, 13,
+    13, 10, 22, 13, 10, 13, 10, 10, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 13, 13, 13, 13, 13, 10, 10, 13, 10, 10, 13,
+    13, 10, 13, 10, 10, 10, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 13, 13, 13, 16, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 11, 11, 11, 11, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 23, 23, 23, 23, 23, 11, 11, 11, 11, 11, 11, 11, 23, 11, 23, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    10, 13, 10, 13, 23, 11, 10, 13, 25, 25, 23, 13, 13, 13, 3, 10, 25, 25, 25, 25, 11, 11, 10, 3, 10, 10, 10, 25, 10, 25, 10, 10,
+    13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 25, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 13, 13, 10, 10, 10, 13, 13, 13, 10, 13, 10, 13, 10, 13, 10, 13,
+    13, 13, 13, 13, 10, 13, 7, 10, 13, 10, 10, 13, 13, 10, 10, 10, 10, 13, 15, 24, 24, 24, 24, 24, 26, 26, 10, 13, 10, 13, 10, 13,
+    10, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 25, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 25, 25, 23, 3, 3, 3, 3, 3, 3, 13, 13, 13, 13, 13, 13, 13, 13, 13, 3, 8, 25, 25, 15, 15, 4,
+    25, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 8, 24,
+    3, 24, 24, 3, 24, 24, 3, 24, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 16, 16, 16, 16, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    27, 27, 27, 27, 27, 27, 7, 7, 7, 3, 3, 4, 3, 3, 15, 15, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 3, 27, 3, 3, 3,
+    23, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 16, 16,
+    24, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 3, 16, 24, 24, 24, 24, 24, 24, 24, 27, 15, 24,
+    24, 24, 24, 24, 24, 23, 23, 24, 24, 15, 24, 24, 24, 24, 16, 16, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 16, 16, 16, 15, 15, 16,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 25, 27, 16, 24, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 24, 24, 24, 23, 23, 15, 3, 3, 3, 23, 25, 25, 24, 4, 4,
+    16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 23, 24, 24, 24, 24, 24, 24, 24, 24, 24, 23, 24, 24, 24, 23, 24, 24, 24, 24, 24, 25, 25,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 25, 25, 3, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 11, 16, 16, 16, 16, 16, 16, 25,
+    27, 27, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24, 16, 16, 16, 16, 16, 16, 16, 16, 16, 23, 24, 24, 24, 24, 24, 24,
+    24, 24, 27, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 28, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 28, 24, 16, 28, 28, 28, 24, 24, 24, 24, 24, 24, 24, 24, 28, 28, 28, 28, 24, 28, 28,
+    16, 24, 24, 24, 24, 24, 24, 24, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    3, 23, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 28, 28, 25, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 16,
+    16, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16,
+    16, 25, 16, 25, 25, 25, 16, 16, 16, 16, 25, 25, 24, 16, 28, 28, 28, 24, 24, 24, 24, 25, 25, 28, 28, 25, 25, 28, 28, 24, 16, 25,
+    25, 25, 25, 25, 25, 25, 25, 28, 25, 25, 25, 25, 16, 16, 25, 16, 16, 16, 24, 24, 25, 25, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    16, 16, 4, 4, 21, 21, 21, 21, 21, 21, 15, 4, 16, 3, 24, 25, 25, 24, 24, 28, 25, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 16,
+    16, 25, 16, 16, 25, 16, 16, 25, 16, 16, 25, 25, 24, 25, 28, 28, 28, 24, 24, 25, 25, 25, 25, 24, 24, 25, 25, 24, 24, 24, 25, 25,
+    25, 24, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 25, 16, 25, 25, 25, 25, 25, 25, 25, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    24, 24, 16, 16, 16, 24, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 28, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16,
+    16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 25, 16, 16, 16, 16, 16, 25, 25, 24, 16, 28, 28,
+    28, 24, 24, 24, 24, 24, 25, 24, 24, 28, 25, 28, 28, 24, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    3, 4, 25, 25, 25, 25, 25, 25, 25, 16, 24, 24, 24, 24, 24, 24, 25, 24, 28, 28, 25, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 16,
+    16, 25, 16, 16, 25, 16, 16, 16, 16, 16, 25, 25, 24, 16, 28, 24, 28, 24, 24, 24, 24, 25, 25, 28, 28, 25, 25, 28, 28, 24, 25, 25,
+    25, 25, 25, 25, 25, 24, 24, 28, 25, 25, 25, 25, 16, 16, 25, 16, 15, 16, 21, 21, 21, 21, 21, 21, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 24, 16, 25, 16, 16, 16, 16, 16, 16, 25, 25, 25, 16, 16, 16, 25, 16, 16, 16, 16, 25, 25, 25, 16, 16, 25, 16, 25, 16, 16,
+    25, 25, 25, 16, 16, 25, 25, 25, 16, 16, 16, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 28, 28,
+    24, 28, 28, 25, 25, 25, 28, 28, 28, 25, 28, 28, 28, 24, 25, 25, 16, 25, 25, 25, 25, 25, 25, 28, 25, 25, 25, 25, 25, 25, 25, 25,
+    21, 21, 21, 15, 15, 15, 15, 15, 15, 4, 15, 25, 25, 25, 25, 25, 24, 28, 28, 28, 24, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16,
+    16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 24, 16, 24, 24,
+    24, 28, 28, 28, 28, 25, 24, 24, 24, 25, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 24, 24, 25, 16, 16, 16, 25, 25, 16, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 3, 21, 21, 21, 21, 21, 21, 21, 15, 16, 24, 28, 28, 3, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16,
+    16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 25, 25, 24, 16, 28, 24, 28, 28, 28, 28, 28, 25, 24, 28, 28, 25, 28, 28, 24, 24, 25, 25,
+    25, 25, 25, 25, 25, 28, 28, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    24, 24, 28, 28, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 16, 28, 28,
+    28, 24, 24, 24, 24, 25, 28, 28, 28, 25, 28, 28, 28, 24, 16, 15, 25, 25, 25, 25, 16, 16, 16, 28, 21, 21, 21, 21, 21, 21, 21, 16,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 15, 16, 16, 16, 16, 16, 16, 25, 24, 28, 28, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 24, 25, 25, 25, 25, 28, 28, 28, 24, 24, 24, 25, 24, 25, 28, 28, 28, 28, 28, 28, 28, 28,
+    25, 25, 28, 28, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 24, 16, 16, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 4, 16, 16, 16, 16, 16, 16, 23, 24, 24, 24, 24, 24, 24, 24, 24, 3,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 16, 16, 25, 16, 25, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 24, 16, 16, 24, 24, 24, 24, 24, 24, 24, 24, 24, 16, 25, 25, 16, 16, 16, 16, 16, 25, 23, 25, 24, 24, 24, 24, 24, 24, 25, 25,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 25, 25, 16, 16, 16, 16, 16, 15, 15, 15, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 15, 3, 15, 15, 15, 24, 24, 15, 15, 15, 15, 15, 15, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 15, 24, 15, 24, 15, 24, 5, 6, 5, 6, 28, 28, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 28,
+    24, 24, 24, 24, 24, 3, 24, 24, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 15, 15, 15, 15, 15, 15, 15, 15, 24, 15, 15, 15, 15, 15, 15, 25, 15, 15,
+    3, 3, 3, 3, 3, 15, 15, 15, 15, 3, 3, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 28, 28, 24, 24, 24,
+    24, 28, 24, 24, 24, 24, 24, 24, 28, 24, 24, 28, 28, 24, 24, 16, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3,
+    16, 16, 16, 16, 16, 16, 28, 28, 24, 24, 16, 16, 16, 16, 24, 24, 24, 16, 28, 28, 28, 16, 16, 28, 28, 28, 28, 28, 28, 28, 16, 16,
+    16, 24, 24, 24, 24, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 28, 28, 24, 24, 28, 28, 28, 28, 28, 28, 24, 16, 28,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 28, 28, 28, 24, 15, 15, 10, 10, 10, 10, 10, 10, 25, 10, 25, 25, 25, 25, 25, 10, 25, 25,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 3, 23, 13, 13, 13, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 25, 16, 25, 16, 16, 16, 16, 25, 25, 16, 25, 16, 16, 16, 16, 25, 25, 16, 16, 16, 16, 16, 16, 16, 25,
+    16, 25, 16, 16, 16, 16, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 24, 24, 24, 3, 3, 3, 3, 3, 3, 3, 3, 3, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25, 25, 25, 25, 25, 25,
+    10, 10, 10, 10, 10, 10, 25, 25, 13, 13, 13, 13, 13, 13, 25, 25, 8, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 15, 3, 16, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 5, 6, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 3, 3, 3, 31, 31,
+    31, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 16, 16, 24, 24, 24, 28, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16,
+    16, 16, 24, 24, 28, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 25, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 24, 24, 28, 24, 24, 24, 24, 24, 24, 24, 28, 28, 28, 28, 28, 28, 28, 28, 24, 28, 28, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 3, 3, 3, 23, 3, 3, 3, 4, 16, 24, 25, 25, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 25, 25, 25, 25, 25, 25,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25, 25, 25, 25, 25, 25, 3, 3, 3, 3, 3, 3, 8, 3, 3, 3, 3, 24, 24, 24, 27, 24,
+    16, 16, 16, 23, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 24, 24, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 16, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25,
+    24, 24, 24, 28, 28, 28, 28, 24, 24, 28, 28, 28, 25, 25, 25, 25, 28, 28, 24, 28, 28, 28, 28, 28, 28, 24, 24, 24, 25, 25, 25, 25,
+    15, 25, 25, 25, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25,
+    16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 19, 25, 25, 25, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 24, 24, 28, 28, 24, 25, 25, 3, 3,
+    16, 16, 16, 16, 16, 28, 24, 28, 24, 24, 24, 24, 24, 24, 24, 25, 24, 28, 24, 28, 28, 24, 24, 24, 24, 24, 24, 24, 24, 28, 28, 28,
+    28, 28, 28, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 24, 3, 3, 3, 3, 3, 3, 3, 23, 3, 3, 3, 3, 3, 3, 25, 25,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 26, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25,
+    24, 24, 24, 24, 28, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 28, 24, 24, 24, 24, 24, 28, 24, 28, 28, 28,
+    28, 28, 24, 28, 28, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 3, 25, 24, 24, 28, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 28, 24, 24, 24, 24, 28, 28, 24, 24, 28, 24, 24, 24, 16, 16, 16, 16, 16, 16, 16, 16, 24, 28, 24, 24, 28, 28, 28, 24, 28, 24,
+    24, 24, 28, 28, 25, 25, 25, 25, 25, 25, 25, 25, 3, 3, 3, 3, 16, 16, 16, 16, 28, 28, 28, 28, 28, 28, 28, 28, 24, 24, 24, 24,
+    24, 24, 24, 24, 28, 28, 24, 24, 25, 25, 25, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 25, 25, 25, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 23, 23, 23, 23, 23, 23, 3, 3, 13, 13, 13, 13, 13, 13, 13, 13, 13, 25, 25, 25, 25, 25, 25, 25,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 25, 25, 10, 10, 10, 3, 3, 3, 3, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25,
+    24, 24, 24, 3, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 28, 24, 24, 24, 24, 24, 24, 24, 16, 16, 16, 16, 24, 16, 16,
+    16, 16, 16, 16, 24, 16, 16, 28, 24, 24, 16, 25, 25, 25, 25, 25, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23, 23, 23, 23, 23, 10, 13, 10, 13, 10, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 13, 13, 25, 25, 10, 10, 10, 10, 10, 10, 25, 25,
+    13, 13, 13, 13, 13, 13, 13, 13, 25, 10, 25, 10, 25, 10, 25, 10, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 25, 25,
+    13, 13, 13, 13, 13, 13, 13, 13, 22, 22, 22, 22, 22, 22, 22, 22, 13, 13, 13, 13, 13, 25, 13, 13, 10, 10, 10, 10, 22, 11, 13, 11,
+    11, 11, 13, 13, 13, 25, 13, 13, 10, 10, 10, 10, 22, 11, 11, 11, 13, 13, 13, 13, 25, 25, 13, 13, 10, 10, 10, 10, 25, 11, 11, 11,
+    13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 11, 11, 11, 25, 25, 13, 13, 13, 25, 13, 13, 10, 10, 10, 10, 22, 11, 11, 25,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 27, 27, 27, 27, 27, 8, 8, 8, 8, 8, 8, 3, 3, 17, 20, 5, 17, 17, 20, 5, 17,
+    3, 3, 3, 3, 3, 3, 3, 3, 32, 33, 27, 27, 27, 27, 27, 14, 3, 3, 3, 3, 3, 3, 3, 3, 3, 17, 20, 3, 3, 3, 3, 12,
+    12, 3, 3, 3, 7, 5, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 7, 3, 12, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 14,
+    27, 27, 27, 27, 27, 25, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 19, 23, 25, 25, 19, 19, 19, 19, 19, 19, 7, 7, 7, 5, 6, 23,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 7, 7, 7, 5, 6, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 26, 26, 26, 26, 24, 26, 26, 26, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 15, 15, 10, 15, 15, 15, 15, 10, 15, 15, 13, 10, 10, 10, 13, 13,
+    10, 10, 10, 13, 15, 10, 15, 15, 7, 10, 10, 10, 10, 10, 15, 15, 15, 15, 15, 15, 10, 15, 10, 15, 10, 15, 10, 10, 10, 10, 15, 13,
+    10, 10, 10, 10, 13, 16, 16, 16, 16, 13, 15, 15, 13, 13, 10, 10, 7, 7, 7, 7, 7, 10, 13, 13, 13, 13, 15, 7, 15, 15, 13, 15,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 10, 13, 31, 31, 31, 31, 21, 15, 15, 25, 25, 25, 25, 7, 7, 7, 7, 7, 15, 15, 15, 15, 15, 7, 7, 15, 15, 15, 15,
+    7, 15, 15, 7, 15, 15, 7, 15, 15, 15, 15, 15, 15, 15, 7, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 7, 7,
+    15, 15, 7, 15, 7, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 15, 15, 15, 15, 15, 15, 15, 15, 5, 6, 5, 6, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 15, 15, 15, 15, 7, 7, 15, 15, 15, 15, 15, 15, 15, 35, 36, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 7, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 7, 7, 7, 7,
+    7, 7, 15, 15, 15, 15, 15, 15, 15, 34, 34, 34, 34, 15, 15, 15, 34, 15, 15, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 25, 25, 25, 25, 25, 25, 25, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25, 25, 25, 25, 25,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 19, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 19,
+    15, 15, 15, 15, 15, 15, 15, 7, 15, 15, 15, 15, 15, 15, 15, 15, 15, 7, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 7, 7, 7, 7, 7, 37, 37, 7, 15, 15, 15, 15, 34, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 7, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34,
+    15, 15, 15, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 15, 15, 15, 15, 15, 34, 34, 15, 15, 15, 15, 15, 15, 15, 15, 34, 15,
+    15, 15, 15, 15, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 15, 15, 15, 15, 15,
+    15, 15, 34, 34, 15, 34, 15, 15, 15, 15, 34, 15, 15, 34, 15, 15, 15, 15, 15, 15, 15, 34, 15, 15, 15, 15, 34, 34, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 15, 34, 15,
+    15, 15, 15, 34, 34, 34, 15, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 5, 6, 5, 6, 5, 6, 5, 6,
+    5, 6, 5, 6, 5, 6, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 21, 15, 34, 34, 34, 15, 15, 15, 15, 15, 15, 15, 15, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34,
+    7, 7, 7, 7, 7, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+    7, 7, 7, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 5, 6, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 6, 7, 7,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 15, 15, 15, 7, 7, 7, 7, 7, 15, 15, 7, 7, 7, 7, 7, 7, 15, 15, 15,
+    34, 15, 15, 15, 15, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 10, 13, 10, 10, 10, 13, 13, 10, 13, 10, 13, 10, 13, 10, 10, 10,
+    10, 13, 10, 13, 13, 10, 13, 13, 13, 13, 13, 13, 23, 23, 10, 10, 10, 13, 10, 13, 13, 15, 15, 15, 15, 15, 15, 10, 13, 10, 13, 24,
+    24, 24, 10, 13, 25, 25, 25, 25, 25, 3, 3, 3, 3, 21, 3, 3, 13, 13, 13, 13, 13, 13, 25, 13, 25, 25, 25, 25, 25, 13, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 23, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24,
+    16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 25,
+    3, 3, 17, 20, 17, 20, 3, 3, 3, 17, 20, 3, 17, 20, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 3, 3, 8, 3, 17, 20, 3, 3,
+    17, 20, 5, 6, 5, 6, 5, 6, 5, 6, 3, 3, 3, 3, 3, 23, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 8, 3, 3, 3, 3,
+    8, 3, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 15, 15, 3, 3, 3, 5, 6, 5, 6, 5, 6, 5, 6, 8, 25, 25,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 25, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 34, 34, 34, 34, 34, 34, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 25, 25, 25, 25, 38, 39, 39, 39, 34, 40, 29, 41, 35, 36, 35, 36, 35, 36, 35, 36,
+    35, 36, 34, 34, 35, 36, 35, 36, 35, 36, 35, 36, 42, 35, 36, 36, 34, 41, 41, 41, 41, 41, 41, 41, 41, 41, 24, 24, 24, 24, 43, 43,
+    42, 40, 40, 40, 40, 40, 34, 34, 41, 41, 41, 40, 29, 39, 34, 15, 25, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 25, 25, 24, 24, 44, 44, 40, 40, 29, 42, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 39, 40, 40, 40, 29, 25, 25, 25, 25, 25, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25, 34, 34, 45, 45, 45, 45, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 25, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 21, 21, 21, 21, 21, 21, 21, 21, 34, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29,
+    46, 29, 29, 46, 29, 29, 29, 46, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29,
+    29, 29, 29, 29, 46, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46,
+    46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 46, 29, 46, 29, 29, 29, 46, 29, 46, 46, 46, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29,
+    29, 46, 46, 46, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29,
+    29, 46, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 46,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 46, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29,
+    29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 40, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 34, 34, 34, 34, 34, 34, 34, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 23, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 16, 16, 25, 25, 25, 25,
+    10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 16, 24, 26, 26, 26, 3, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 3, 23,
+    10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 23, 23, 24, 24, 16, 16, 16, 16, 16, 16, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    24, 24, 3, 3, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 11, 11, 11, 11, 11, 11, 11, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    11, 11, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 13, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13,
+    23, 13, 13, 13, 13, 13, 13, 13, 13, 10, 13, 10, 13, 10, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 23, 11, 11, 10, 13, 10, 13, 16,
+    10, 13, 10, 13, 13, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 10, 10, 10, 10, 13,
+    10, 10, 10, 10, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 13, 10, 10, 10, 10, 13, 10, 13, 25, 25, 25, 25, 25,
+    10, 13, 25, 13, 25, 13, 10, 13, 10, 13, 25, 25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 10, 13, 16, 23, 23, 13, 16, 16, 16, 16, 16,
+    16, 16, 24, 16, 16, 16, 24, 16, 16, 16, 16, 24, 16, 16, 16, 16, 16, 16, 16, 28, 28, 24, 24, 28, 15, 15, 15, 15, 24, 25, 25, 25,
+    21, 21, 21, 21, 21, 21, 15, 15, 4, 15, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25,
+    28, 28, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 3, 3, 24, 24, 16, 16, 16, 16, 16, 16, 3, 3, 3, 16, 3, 16, 16, 24,
+    16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 24, 24, 3, 3, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 28, 28, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 3, 16, 16, 16, 24, 28, 28, 24, 24, 24, 24, 28, 28, 24, 24, 28, 28,
+    28, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 25, 23, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 25, 25, 25, 25, 3, 3,
+    16, 16, 16, 16, 16, 24, 23, 16, 16, 16, 16, 16, 16, 16, 16, 16, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 16, 16, 16, 16, 16, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 28, 28, 24, 24, 28, 28, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 24, 16, 16, 16, 16, 16, 16, 16, 16, 24, 28, 25, 25, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 25, 25, 3, 3, 3, 3,
+    23, 16, 16, 16, 16, 16, 16, 15, 15, 15, 16, 28, 24, 28, 16, 16, 24, 16, 24, 24, 24, 16, 16, 24, 24, 16, 16, 16, 16, 16, 24, 24,
+    16, 24, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 23, 3, 3,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 28, 24, 24, 28, 28, 3, 3, 16, 23, 23, 28, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 16, 16, 16, 16, 16, 16, 25, 25, 16, 16, 16, 16, 16, 16, 25, 25, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 11, 23, 23, 23, 23, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23, 11, 11, 25, 25, 25, 25,
+    16, 16, 16, 28, 28, 24, 28, 28, 24, 28, 28, 3, 28, 24, 25, 25, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 16, 16, 16, 16, 16, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 29, 29, 29, 46, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29,
+    29, 46, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 13, 13, 13, 13, 13, 13, 13, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 13, 13, 13, 13, 13, 25, 25, 25, 25, 25, 16, 24, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 7, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 25, 16, 25, 16, 16, 25, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 6, 5,
+    25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 15,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4, 15, 15, 15, 39, 39, 39, 39, 39, 39, 39, 35, 36, 39, 25, 25, 25, 25, 25, 25,
+    39, 42, 42, 49, 49, 35, 36, 35, 36, 35, 36, 35, 36, 35, 36, 35, 36, 35, 36, 35, 36, 39, 39, 35, 36, 39, 39, 39, 39, 49, 49, 49,
+    39, 39, 39, 25, 39, 39, 39, 39, 42, 35, 36, 35, 36, 35, 36, 39, 39, 39, 37, 42, 37, 37, 37, 25, 39, 50, 39, 39, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 27,
+    25, 39, 39, 39, 50, 39, 39, 39, 35, 36, 39, 37, 39, 42, 39, 39, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 39, 39, 37, 37, 37, 39,
+    39, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 35, 39, 36, 44, 49,
+    44, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 35, 37, 36, 37, 35,
+    36, 3, 5, 6, 3, 3, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 23, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 23, 23, 25, 25, 16, 16, 16, 16, 16, 16, 25, 25, 16, 16, 16, 16, 16, 16,
+    25, 25, 16, 16, 16, 16, 16, 16, 25, 25, 16, 16, 16, 25, 25, 25, 50, 50, 37, 44, 34, 50, 50, 25, 15, 7, 7, 7, 7, 15, 15, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 27, 27, 27, 15, 15, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 25, 16, 3, 3, 3, 25, 25, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 25, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 31, 31, 31, 31, 31, 21, 21, 21, 21, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 21, 21, 15, 15, 15, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25, 25, 25,
+    15, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 24, 25, 25,
+    24, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25, 25, 25, 25,
+    21, 21, 21, 21, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 31, 16, 16, 16, 16, 16, 16, 16, 16, 31, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 3,
+    16, 16, 16, 16, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 3, 31, 31, 31, 31, 31, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 25, 25, 25, 25, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 3, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 25, 10, 10, 10, 10,
+    10, 10, 10, 25, 10, 10, 25, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 25, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 25, 13, 13, 13, 13, 13, 13, 13, 25, 13, 13, 25, 25, 25, 23, 23, 23, 23, 23, 23, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 25, 25, 16, 25, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 25, 16, 16, 25, 25, 25, 16, 25, 25, 16, 16, 16, 16, 16, 16, 16, 25, 3, 21, 21, 21, 21, 21, 21, 21, 21,
+    16, 16, 16, 16, 16, 16, 16, 15, 15, 21, 21, 21, 21, 21, 21, 21, 25, 25, 25, 25, 25, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    16, 16, 16, 25, 16, 16, 25, 25, 25, 25, 25, 21, 21, 21, 21, 21, 16, 16, 16, 16, 16, 16, 21, 21, 21, 21, 21, 21, 25, 25, 25, 3,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 3, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 21, 21, 16, 16,
+    25, 25, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 16, 24, 24, 24, 25, 24, 24, 25, 25, 25, 25, 25, 24, 24, 24, 24,
+    16, 16, 16, 16, 25, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 24, 24, 24, 25, 25, 25, 25, 24,
+    19, 19, 19, 19, 21, 21, 21, 21, 21, 25, 25, 25, 25, 25, 25, 25, 3, 3, 3, 3, 3, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 21, 21, 3, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 21, 21, 21,
+    16, 16, 16, 16, 16, 16, 16, 16, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 25, 25, 25, 25, 21, 21, 21, 21, 21,
+    3, 3, 3, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 25, 25, 25, 3, 3, 3, 3, 3, 3, 3,
+    16, 16, 16, 16, 16, 16, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21, 16, 16, 16, 25, 25, 25, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21,
+    16, 16, 25, 25, 25, 25, 25, 25, 25, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 21, 21, 21, 21, 21, 21, 21,
+    10, 10, 10, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 13, 13, 13, 25, 25, 25, 25, 25, 25, 25, 21, 21, 21, 21, 21, 21,
+    16, 16, 16, 16, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 24, 24, 8, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    21, 21, 21, 21, 21, 21, 21, 16, 25, 25, 25, 25, 25, 25, 25, 25, 24, 21, 21, 21, 21, 3, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25,
+    16, 16, 24, 24, 24, 24, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 21, 21, 21, 21, 21, 21, 21, 25, 25, 25, 25,
+    28, 24, 28, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 3, 3, 3, 3, 3, 3, 3, 25, 25, 25, 25, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 24, 16, 16, 24, 24, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24,
+    28, 28, 28, 24, 24, 24, 24, 28, 28, 24, 24, 3, 3, 27, 3, 3, 3, 3, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 27, 25, 25,
+    24, 24, 24, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 28, 24, 24, 24,
+    24, 24, 24, 24, 24, 25, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 16, 28, 28, 16, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 24, 3, 3, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 28, 28, 28, 24, 24, 24, 24, 24, 24, 24, 24, 24, 28,
+    28, 16, 16, 16, 16, 3, 3, 3, 3, 24, 24, 24, 24, 3, 28, 24, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 16, 3, 16, 3, 3, 3,
+    25, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 28, 28, 28, 24, 24, 24, 28, 28, 24, 28, 24, 24, 3, 3, 3, 3, 3, 3, 24, 25,
+    16, 16, 16, 16, 16, 16, 16, 25, 16, 25, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 3, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24,
+    28, 28, 28, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 24, 24, 28, 28, 25, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 16,
+    16, 25, 16, 16, 25, 16, 16, 16, 16, 16, 25, 24, 24, 16, 28, 28, 24, 28, 28, 28, 28, 25, 25, 28, 28, 25, 25, 28, 28, 28, 25, 25,
+    16, 25, 25, 25, 25, 25, 25, 28, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 28, 28, 25, 25, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25,
+    24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 28, 28, 28, 24, 24, 24, 24, 24, 24, 24, 24,
+    28, 28, 24, 24, 24, 28, 24, 16, 16, 16, 16, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 25, 3, 24, 16,
+    28, 28, 28, 24, 24, 24, 24, 24, 24, 28, 24, 28, 28, 28, 28, 24, 24, 28, 24, 24, 16, 16, 3, 16, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 28, 28, 28, 24, 24, 24, 24, 25, 25, 28, 28, 28, 28, 24, 24, 28, 24,
+    24, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 16, 16, 16, 16, 24, 24, 25, 25,
+    28, 28, 28, 24, 24, 24, 24, 24, 24, 24, 24, 28, 28, 24, 28, 24, 24, 3, 3, 3, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 28, 24, 28, 28,
+    24, 24, 24, 24, 24, 24, 28, 24, 16, 3, 25, 25, 25, 25, 25, 25, 28, 28, 24, 24, 24, 24, 28, 24, 24, 24, 24, 24, 25, 25, 25, 25,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 21, 21, 3, 3, 3, 15, 24, 24, 24, 24, 24, 24, 24, 24, 28, 24, 24, 3, 25, 25, 25, 25,
+    21, 21, 21, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 16, 25, 25, 16, 16, 16, 16,
+    16, 16, 16, 16, 25, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 28, 28, 28, 28, 28, 28, 25, 28, 28, 25, 25, 24, 24, 28, 24, 16,
+    28, 16, 28, 24, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 16, 16, 16, 16, 16, 16,
+    16, 28, 28, 28, 24, 24, 24, 24, 25, 25, 24, 24, 28, 28, 28, 28, 24, 16, 3, 16, 28, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 28, 16, 24, 24, 24, 24, 3,
+    3, 3, 3, 3, 3, 3, 3, 24, 25, 25, 25, 25, 25, 25, 25, 25, 16, 24, 24, 24, 24, 24, 24, 28, 28, 24, 24, 24, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 28, 24, 24, 3, 3, 3, 16, 3, 3,
+    3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24, 24, 24, 25, 24, 24, 24, 24, 24, 24, 28, 24,
+    16, 3, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25, 25, 25,
+    3, 3, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 25, 28, 24, 24, 24, 24, 24, 24, 24, 28, 24, 24, 28, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 25, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24, 24, 24, 25, 25, 25, 24, 25, 24, 24, 25, 24,
+    24, 24, 24, 24, 24, 24, 16, 24, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 16, 16, 16, 25, 16, 16, 25, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 28, 28, 28, 28, 28, 25, 24, 24, 25, 28, 28, 24, 28, 24, 16, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 24, 24, 28, 28, 3, 3, 25, 25, 25, 25, 25, 25, 25, 21, 21, 21, 21, 21, 15, 15, 15, 15, 15, 15, 15, 15, 4, 4, 4,
+    4, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 3,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 25, 3, 3, 3, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 3, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24, 3, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    24, 24, 24, 24, 24, 24, 24, 3, 3, 3, 3, 3, 15, 15, 15, 15, 23, 23, 23, 23, 3, 15, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 25, 21, 21, 21, 21, 21, 21, 21, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 21, 21, 21, 21, 21, 21, 21, 3, 3, 3, 3, 25, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25, 24, 16, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 25, 25, 25, 25, 25, 25, 25, 24,
+    24, 24, 24, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 40, 40, 39, 40, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    43, 43, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25,
+    29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25,
+    40, 40, 40, 40, 25, 40, 40, 40, 40, 40, 40, 40, 25, 40, 40, 25, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 15, 24, 24, 3, 27, 27, 27, 27, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 24, 24, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    15, 15, 15, 15, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 15, 15, 15, 15, 15, 15, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    15, 15, 15, 15, 15, 15, 15, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 28, 28, 24, 24, 24, 15, 15, 15, 28, 28, 28,
+    28, 28, 28, 27, 27, 27, 27, 27, 27, 27, 27, 24, 24, 24, 24, 24, 24, 24, 24, 15, 15, 24, 24, 24, 24, 24, 24, 24, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 24, 24, 24, 24, 15, 15, 15, 15, 24, 24, 24, 15, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    21, 21, 21, 21, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25, 25, 25, 25, 25, 25, 25,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 13, 13, 13, 25, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    10, 10, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 25, 10, 10,
+    25, 25, 10, 25, 25, 10, 10, 25, 25, 10, 10, 10, 10, 25, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 25, 13, 25, 13, 13, 13,
+    13, 13, 13, 13, 25, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 25, 10, 10, 10, 10, 25, 25, 10, 10, 10,
+    10, 10, 10, 10, 10, 25, 10, 10, 10, 10, 10, 10, 10, 25, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 25, 10, 10, 10, 10, 25,
+    10, 10, 10, 10, 10, 25, 10, 25, 25, 25, 10, 10, 10, 10, 10, 10, 10, 25, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 25, 25, 10, 10, 10, 10, 10, 10, 10, 10, 10, 7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 7, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 7, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 7, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 7,
+    13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 7,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 7, 13, 13, 13, 13, 13, 13, 10, 10, 10, 10, 10, 10, 10, 10, 10, 7, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 7, 13, 13, 13, 13, 13, 13, 10, 13, 25, 25, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    24, 24, 24, 24, 24, 24, 24, 15, 15, 15, 15, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 15, 15, 15,
+    15, 15, 15, 15, 15, 24, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 24, 15, 15, 3, 3, 3, 3, 3, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 24, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 16, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 25, 24, 24, 24, 24, 24, 24, 24, 25, 24, 24, 24, 24, 24, 24, 24, 24,
+    24, 24, 24, 24, 24, 24, 24, 24, 24, 25, 25, 24, 24, 24, 24, 24, 24, 24, 25, 24, 24, 25, 24, 24, 24, 24, 24, 25, 25, 25, 25, 25,
+    24, 24, 24, 24, 24, 24, 24, 23, 23, 23, 23, 23, 23, 23, 25, 25, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 25, 25, 25, 25, 16, 15,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 24, 24, 24, 24,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 25, 25, 25, 25, 25, 4, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 25, 16, 16, 25,
+    16, 16, 16, 16, 16, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21, 21, 13, 13, 13, 13, 24, 24, 24, 24, 24, 24, 24, 23, 25, 25, 25, 25,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 15, 21, 21, 21, 4, 21, 21, 21, 21, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 15, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 25, 25,
+    16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 25, 16, 25, 25, 16, 25, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 25, 16, 16, 16, 16, 25, 16, 25, 16, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 16, 25, 16, 25, 16, 25, 16, 16, 16,
+    25, 16, 16, 25, 16, 25, 25, 16, 25, 16, 25, 16, 25, 16, 25, 16, 25, 16, 16, 25, 16, 25, 25, 16, 16, 16, 16, 25, 16, 16, 16, 16,
+    16, 16, 16, 25, 16, 16, 16, 16, 25, 16, 16, 16, 16, 25, 16, 25, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16,
+    25, 16, 16, 16, 25, 16, 16, 16, 16, 16, 25, 16, 16, 16, 16, 16, 7, 7, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25, 25, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25,
+    25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 21, 21, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 15,
+    15, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25, 25,
+    25, 25, 25, 25, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 34, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 25, 25, 25, 25, 25, 25, 25, 34, 34, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15, 15, 15, 15, 34,
+    34, 15, 15, 15, 34, 15, 15, 15, 34, 34, 34, 44, 44, 44, 44, 44, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15,
+    34, 15, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15, 15, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 34, 34, 15,
+    34, 34, 34, 34, 34, 34, 34, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15, 15, 15, 15, 15, 15, 34, 15, 15, 15,
+    34, 34, 34, 15, 15, 34, 34, 34, 25, 25, 25, 25, 25, 34, 34, 34, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 25, 25, 25,
+    15, 15, 15, 15, 34, 34, 34, 34, 34, 34, 34, 34, 34, 25, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 25, 25, 25, 25, 25, 25, 25,
+    34, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 25, 25, 25, 25, 25, 25, 25, 25,
+    15, 15, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 15, 34, 34, 34, 34, 34, 34, 34, 34, 34, 25, 25, 25, 34, 34, 34, 34, 34, 25, 25, 25,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 25, 25, 25, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 25, 25, 25, 25, 25,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 25, 25, 25, 25, 25, 25, 34, 34, 34, 34, 34, 34, 34, 34, 25, 25, 25, 25, 25, 25, 25, 25,
+    15, 15, 15, 25, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 46, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    29, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25,
+    25, 27, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 25, 25,
+  };
+  return t;
+}
+
+} // namespace props
+} // namespace detail
+} // namespace minicode
+
+#endif // _MINICODE_UNICODE_TABLES_H_
@@ -1,8 +1,13 @@
 #include <iostream>
 #include <fstream>
+#include <chrono>
 #include <string>
 #include <cstdlib>
+#include <atomic>
+#include <thread>
 #include "minicode.h"
+#include "minicode_cjk.h"
+#include "minicode_unicode.h"
 
 using namespace std;
 using minicode::bytes;
@@ -73,30 +78,1153 @@ void test_encode_decode(const str& ss, const bytes& bb) {
 }
 
 template<typename T>
-void test_stream(const string& filename, const str& ss) {
+void test_stream(const string& filename, const str& ss, int chunk) {
   minicode::stream<T> stream;
   int idx = 0;
   bool err_flag = false;
   minicode::uchar uc;
-  std::vector<char> buffer(16);
+  std::vector<char> buffer(chunk);
   ifstream file(filename, std::ios::binary);
   do {
-    file.read(buffer.data(), 16);
-    stream.add_bytes(buffer);
+    file.read(buffer.data(), chunk);
+    stream.add_bytes(buffer.data(), file.gcount());
     while (stream.get(uc)) {
-      if (uc != ss[idx]) {
+      if (idx >= (int)ss.size() || uc != ss[idx]) {
         err_flag = true;
-        cout<<"error: idx:"<<idx<<" uc:"<<uc.value()<<" ss[idx]:"<<ss[idx].value()<<endl;
+        cout<<"error: idx:"<<idx<<" uc:"<<uc.value()<<endl;
+        break;
       }
       ++idx;
     }
-  } while (file.good());
-  if (!err_flag) {
+  } while (file.good() && !err_flag);
+  if (!err_flag && idx == (int)ss.size() && stream.eof() && !stream.bad()) {
     cout<<"true"<<endl<<endl;
+  } else {
+    cout<<"false"<<endl<<endl;
   }
 }
 
 
+template<typename T>
+void test_stream_read(const str& ss) {
+  bytes bs;
+  minicode::encode<T>(ss, bs);
+  // odd chunk sizes split sequences, read_into keeps the tails buffered
+  minicode::stream<T> st1;
+  str s1;
+  for (int i = 0; i < (int)bs.size(); i += 1237) {
+    st1.add_bytes(bs.subrange(i, i + 1237).as_view());
+    st1.read_into(s1);
+  }
+  // read_until cuts at each ascii space
+  minicode::stream<T> st2(bs.as_view());
+  str s2, line;
+  int lines = 0;
+  while (st2.read_until(minicode::uchar(' '), line)) {
+    ++lines;
+    if (line[-1] != minicode::uchar(' ')) {
+      break;
+    }
+  }
+  s2 = line;
+  // read with a small output
+  minicode::stream<T> st3(bs.as_view());
+  std::vector<minicode::uchar> s3(ss.size());
+  size_t n = 0, m = 0;
+  while ((m = st3.read(s3.data() + n, 7)) > 0) {
+    n += m;
+  }
+  bool equal1 = (s1 == ss && st1.eof() && !st1.bad());
+  bool equal2 = (s2 == ss && lines > 0 && st2.eof());
+  bool equal3 = (n == ss.size() && str(s3.data(), n) == ss);
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// seconds for appends of 4KB, each followed by reading 4KB, with lag bytes left unread
+double stream_lag_time(size_t lag) {
+  minicode::stream<minicode::utf8> st;
+  std::vector<char> chunk(4096, 'a');
+  std::vector<minicode::uchar> out(4096);
+  for (size_t n = 0; n < lag; n += chunk.size()) {
+    st.add_bytes(chunk.data(), chunk.size());
+  }
+  auto t0 = chrono::steady_clock::now();
+  for (int i = 0; i < 3000; ++i) {
+    st.add_bytes(chunk.data(), chunk.size());
+    st.read(out.data(), out.size());
+  }
+  return chrono::duration<double>(chrono::steady_clock::now() - t0).count() + (st.available() == (int)lag ? 0 : 1e9);
+}
+
+// the cost of an append does not grow with the bytes the reader leaves behind,
+// even when they keep the buffer just short of full
+void test_stream_lag() {
+  double t1 = stream_lag_time((64 << 10) - 4096);
+  double t2 = stream_lag_time((8 << 20) - 4096);
+  bool equal1 = (t2 < 4 * t1 + 0.05);
+  cout<<boolalpha<<"compare "<<equal1<<endl;
+  cout<<endl;
+}
+
+template<typename T1, typename T2>
+void test_transcoder(const str& ss) {
+  bytes b1, b2;
+  minicode::encode<T1>(ss, b1);
+  minicode::encode<T2>(ss, b2);
+  // sink mode, chunks of many sizes
+  std::vector<char> out;
+  minicode::transcoder<T1, T2> tc([&out](const char* b, size_t n) {
+    out.insert(out.end(), b, b + n);
+  }, 100);
+  bool ok = true;
+  for (int i = 0, k = 1; i < (int)b1.size(); i += k, k = k % 13 + 1) {
+    ok = ok && tc.feed(b1.subrange(i, i + k).as_view());
+  }
+  bool equal1 = (ok && tc.finish() == 0 && bytes(out.data(), out.size()) == b2);
+  // buffer mode with a tiny output, then a multi-byte last character cut short
+  str st(ss);
+  st.resize(st.size() + 1);
+  st[(int)st.size() - 1] = minicode::uchar(0x4e2du);
+  bytes b5;
+  minicode::encode<T1>(st, b5);
+  minicode::transcoder<T1, T2> tb;
+  std::vector<char> buff(b2.size());
+  char *ob = buff.data();
+  const char *ib = b5.data();
+  const char *ie = b5.limit() - 1;
+  while (ib < ie && tb.convert(ib, ie, ob, std::min(ob + 5, buff.data() + buff.size()))) {
+  }
+  bool equal2 = (tb.good() && ib == ie && tb.finish() > 0 && bytes(buff.data(), ob - buff.data()) == b2);
+  // invalid input reports its offset
+  bytes b3 = b1;
+  b3[(int)(b3.size() / 2)] = (char)0xdc;
+  b3[(int)(b3.size() / 2) + 1] = (char)0xdc;
+  b3[(int)(b3.size() / 2) + 2] = (char)0xdc;
+  b3[(int)(b3.size() / 2) + 3] = (char)0xdc;
+  bytes b4;
+  int r = minicode::convert<T1, T2>(b3, b4);
+  minicode::transcoder<T1, T2> te([](const char*, size_t) {});
+  for (int i = 0; i < (int)b3.size(); i += 3) {
+    te.feed(b3.subrange(i, i + 3).as_view());
+  }
+  bool equal3 = (te.bad() && te.offset() == b3.size() - r);
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+template<typename T1, typename T2>
+void test_parallel(const str& ss) {
+  bytes b1;
+  minicode::encode<T1>(ss, b1);
+  minicode::parallel_policy pp(4, 1000);
+  bool equal1 = true;
+  bool equal2 = true;
+  for (int k = 0; k < 32; ++k) {
+    bytes b2 = b1;
+    if (k > 0) {
+      b2[(int)(k * 7919u % b2.size())] = (char)(0x80 + k);
+      b2[(int)(k * 104729u % b2.size())] = (char)0xdc;
+    }
+    bytes b3, b4;
+    int x1 = minicode::convert<T1, T2>(b2, b3);
+    int x2 = minicode::convert<T1, T2>(b2, b4, pp);
+    equal1 = equal1 && x1 == x2 && b3 == b4;
+    str s1, s2;
+    int y1 = minicode::decode<T1>(b2, s1);
+    int y2 = minicode::decode<T1>(b2, s2, pp);
+    equal2 = equal2 && y1 == y2 && s1 == s2;
+  }
+  // an exception on the calling thread comes out once the others are done
+  std::atomic<int> done(0);
+  bool thrown = false;
+  try {
+    minicode::detail::parallel_for(4, [&done](size_t i) {
+      if (i == 0) {
+        throw std::runtime_error("stop");
+      }
+      ++done;
+    });
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  bool equal3 = (thrown && done == 3);
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+template<typename T1, typename T2>
+void test_file(const string& in, const string& expected, const str& ss) {
+  long long x = minicode::convert_file<T1, T2>(in.c_str(), "file_test.txt", 1000);
+  bool equal1 = (x == 0 && read_file("file_test.txt") == read_file(expected));
+  str s1;
+  long long y = minicode::decode_file<T1>(in.c_str(), s1);
+  bool equal2 = (y == 0 && s1 == ss);
+  bool equal3 = (minicode::convert_file<T1, T2>("no_such_file.txt", "file_test.txt") == -1);
+  // a fifo has no size to map, it is read through
+  ::unlink("fifo_test.txt");
+  bool equal4 = (::mkfifo("fifo_test.txt", 0600) == 0);
+  if (equal4) {
+    std::thread w([&in] {
+      ofstream f("fifo_test.txt", std::ios::binary);
+      bytes b = read_file(in);
+      f.write(b.data(), b.size());
+    });
+    str s2;
+    long long z = minicode::decode_file<T1>("fifo_test.txt", s2);
+    w.join();
+    equal4 = (z == 0 && s2 == ss);
+    ::unlink("fifo_test.txt");
+  }
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<" "<<equal4<<endl;
+  cout<<endl;
+}
+
+template<typename T>
+void test_compact(const str& ss, int width) {
+  bytes b1, b2;
+  minicode::encode<T>(ss, b1);
+  minicode::compact_str cs;
+  int x = minicode::decode<T>(b1, cs);
+  int y = minicode::encode<T>(cs, b2);
+  bool equal1 = (x == 0 && y == 0 && cs.width() == width && cs.size() == ss.size() &&
+                 cs.to_str() == ss && b2 == b1 && minicode::compact_str(ss) == cs);
+  bool equal2 = true;
+  for (int i = -50; i < 50; ++i) {
+    int k = (i * 7919) % (int)ss.size();
+    equal2 = equal2 && cs[k] == ss[k] &&
+             cs.find(ss[k], k / 2) == ss.find(ss[k], k / 2) &&
+             cs.rfind(ss[k], 0, k + 1) == ss.rfind(ss[k], 0, k + 1) &&
+             cs.find(ss[k], k / 3, k / 3 + 13) == ss.find(ss[k], k / 3, k / 3 + 13) &&
+             cs.rfind(ss[k], k / 3, k / 3 + 13) == ss.rfind(ss[k], k / 3, k / 3 + 13);
+  }
+  equal2 = equal2 && cs.find(minicode::uchar(0x10fffeu)) == ss.find(minicode::uchar(0x10fffeu)) &&
+           cs.rfind(minicode::uchar(0x10fffeu)) == ss.rfind(minicode::uchar(0x10fffeu));
+  minicode::compact_str sub = cs.subrange(10, 20);
+  equal2 = equal2 && sub.to_str() == ss.subrange(10, 20) &&
+           std::equal(cs.begin(), cs.end(), ss.data()) && cs.end() - cs.begin() == (int)ss.size();
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<endl;
+  cout<<endl;
+}
+
+void test_u8str(const str& ss) {
+  minicode::u8str us(ss);
+  bytes b1;
+  minicode::encode<minicode::utf8>(ss, b1);
+  bool equal1 = (us.as_bytes() == b1 && us.size() == ss.size() && us.to_str() == ss &&
+                 minicode::u8str(minicode::bytes_view(b1)) == us);
+  bool equal2 = true;
+  for (int i = -50; i < 50; ++i) {
+    int k = (i * 7919) % (int)ss.size();
+    equal2 = equal2 && us[k] == ss[k] &&
+             us.find(ss[k], k / 2) == ss.find(ss[k], k / 2) &&
+             us.rfind(ss[k], 0, k + 1) == ss.rfind(ss[k], 0, k + 1);
+  }
+  for (int k = 0; k <= (int)ss.size(); k += 13) {
+    equal2 = equal2 && us.index(us.offset(k)) == (size_t)k;
+  }
+  equal2 = equal2 && us.subrange(10, 200).to_str() == ss.subrange(10, 200) &&
+           us.subrange(-64, -1).to_str() == ss.subrange(-64, -1);
+  // invalid tail is left out
+  std::vector<char> b2(b1.data(), b1.data() + b1.size());
+  b2.insert(b2.end(), {'\xed', '\xa0', '\x80', 'a', 'b', 'c'});
+  minicode::u8str bad;
+  bool equal3 = (bad.assign(b2) == 6 && bad == us);
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// deterministic mixed text: ascii runs, latin, cjk and emoji
+str mixed_unicode(int n, unsigned seed) {
+  vector<minicode::uchar> vv;
+  while ((int)vv.size() < n) {
+    seed = seed * 1103515245 + 12345;
+    int kind = (seed >> 16) % 4;
+    int run = 1 + (seed >> 8) % 40;
+    for (int i = 0; i < run; ++i) {
+      seed = seed * 1103515245 + 12345;
+      uint32_t r = seed >> 8;
+      uint32_t base[] = {0x20, 0xa0, 0x4e00, 0x1f300};
+      uint32_t span[] = {0x5f, 0x500, 0x5000, 0x300};
+      vv.push_back(minicode::uchar(base[kind] + r % span[kind]));
+    }
+  }
+  str ss;
+  ss.assign(vv.data(), vv.data() + vv.size());
+  return ss;
+}
+
+// reference results through the per code point functors
+template<typename T>
+int scalar_encode(const str& ss, bytes& bs) {
+  std::vector<char> b(ss.size() * 4 + 4);
+  int i = 0, j = 0;
+  T t;
+  for (; i < (int)ss.size(); ++i) {
+    int p = t(ss[i], b.data() + j, b.size() - j);
+    if (p < 0) {
+      break;
+    }
+    j += p;
+  }
+  bs.assign(b.data(), b.data() + j);
+  return ss.size() - i;
+}
+
+template<typename T>
+int scalar_decode(const bytes& bs, str& ss) {
+  std::vector<minicode::uchar> s(bs.size());
+  int i = 0, j = 0;
+  T t;
+  while (i < (int)bs.size()) {
+    int p = t(bs.data() + i, bs.size() - i, s[j]);
+    if (p < 0) {
+      break;
+    }
+    i += p;
+    ++j;
+  }
+  ss.assign(s.data(), s.data() + j);
+  return bs.size() - i;
+}
+
+template<typename T1, typename T2>
+int scalar_convert(const bytes& b1, bytes& b2) {
+  std::vector<char> b(b1.size() * 4 + 4);
+  int i = 0, j = 0;
+  T1 t1;
+  T2 t2;
+  while (i < (int)b1.size()) {
+    minicode::uchar u;
+    int p = t1(b1.data() + i, b1.size() - i, u);
+    if (p < 0) {
+      break;
+    }
+    int q = t2(u, b.data() + j, b.size() - j);
+    if (q < 0) {
+      break;
+    }
+    i += p;
+    j += q;
+  }
+  b2.assign(b.data(), b.data() + j);
+  return b1.size() - i;
+}
+
+template<typename T1, typename T2>
+void test_transcode(const str& ss) {
+  bytes b1, b2, b3;
+  minicode::encode<T1>(ss, b1);
+  int x1 = minicode::convert<T1, T2>(b1, b2);
+  int x2 = scalar_convert<T1, T2>(b1, b3);
+  bool equal1 = (x1 == x2 && b2 == b3);
+  bool equal2 = true;
+  for (int k = 1; k < 64; ++k) {
+    bytes b4 = b1;
+    b4[(int)(k * 7919u % b4.size())] = (char)(0x80 + k);
+    b4[(int)(k * 104729u % b4.size())] = (char)(0xd8 + k % 8);
+    bytes b5, b6;
+    int z1 = minicode::convert<T1, T2>(b4, b5);
+    int z2 = scalar_convert<T1, T2>(b4, b6);
+    equal2 = equal2 && z1 == z2 && b5 == b6;
+  }
+  // input that ends right after a block of ascii, with more bytes behind it
+  str a(48, minicode::uchar('a'));
+  minicode::encode<T1>(str(56, minicode::uchar('a')), b1);
+  minicode::encode<T2>(a, b2);
+  std::vector<char> out(b1.size() * 4);
+  const char *ib = b1.data();
+  const char *ie = b1.data() + b1.size() / 56 * 48;
+  char *ob = out.data();
+  minicode::detail::transcode<T1, T2>::convert(ib, ie, ob, out.data() + out.size());
+  equal2 = equal2 && ib == ie && bytes(out.data(), ob - out.data()) == b2;
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<endl;
+  cout<<endl;
+}
+
+// lengths under the policy P against the caller-provided buffer overloads, which size nothing
+template<typename T1, typename T2, typename P>
+bool check_lengths(const bytes& b, const str& s) {
+  std::vector<char> out(4 * (b.size() + s.size()) + 16);
+  std::vector<minicode::uchar> u(b.size() + 1);
+  size_t m1 = 0, m2 = 0, m3 = 0;
+  minicode::encode<T1, P>(s, out.data(), out.size(), m1);
+  minicode::decode<T1, P>(b, u.data(), u.size(), m2);
+  minicode::convert<T1, T2, P>(b, out.data(), out.size(), m3);
+  return (minicode::encoded_length<T1, P>(s) == m1 && minicode::decoded_length<T1, P>(b) == m2 &&
+          minicode::converted_length<T1, T2, P>(b) == m3);
+}
+
+template<typename T1, typename T2>
+void test_length(const str& ss) {
+  bytes b1, b2, b3;
+  str s1;
+  minicode::encode<T1>(ss, b1);
+  minicode::convert<T1, T2>(b1, b2);
+  bool equal1 = (minicode::encoded_length<T1>(ss) == b1.size() &&
+                 minicode::decoded_length<T1>(b1) == ss.size() &&
+                 minicode::converted_length<T1, T2>(b1) == b2.size());
+  // a caller-provided buffer stops where it is full
+  std::vector<char> buff(b2.size() / 2);
+  size_t m = 0;
+  int x = minicode::convert<T1, T2>(b1, buff.data(), buff.size(), m);
+  bool equal2 = (x > 0 && m <= buff.size() && bytes(buff.data(), m) == bytes(b2.data(), m));
+  // append twice and compare with the halves
+  b3 = bytes("@", 1);
+  minicode::encode<T1>(ss, b3, minicode::append);
+  minicode::decode<T1>(b1, s1, minicode::append);
+  minicode::decode<T1>(b1, s1, minicode::append);
+  bool equal3 = (b3.size() == b1.size() + 1 && bytes(b3.data() + 1, b1.size()) == b1 &&
+                 s1.size() == 2 * ss.size() && str(s1.data() + ss.size(), ss.size()) == ss);
+  // errors in the middle, the counters stop there and the scratch kernels go on
+  bool equal4 = true;
+  for (int k = 1; k < 16; ++k) {
+    bytes b4 = b1;
+    b4[(int)(k * 7919u % b4.size())] = (char)(0x80 + k);
+    b4[(int)(k * 104729u % b4.size())] = (char)(0xd8 + k % 8);
+    str s4 = ss;
+    s4[(int)(k * 7919u % s4.size())] = minicode::uchar(0xd800u + k);
+    s4[(int)(k * 104729u % s4.size())] = minicode::uchar(0x110000u + k);
+    equal4 = (equal4 && check_lengths<T1, T2, minicode::errors::strict>(b4, s4) &&
+              check_lengths<T1, T2, minicode::errors::replace>(b4, s4) &&
+              check_lengths<T1, T2, minicode::errors::ignore>(b4, s4));
+  }
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<" "<<equal4<<endl;
+  cout<<endl;
+}
+
+void test_view() {
+  string text = "hello, \xe4\xb8\xad\xe6\x96\x87, hello";
+  minicode::bytes_view bv(text);
+  bytes bs(text.data(), text.size());
+  // same indexing as the owning sequence, subrange shares memory
+  bool equal1 = (bv.find('l') == bs.find('l') && bv.rfind('l') == bs.rfind('l') &&
+                 bv.find('l', -5) == bs.find('l', -5) && bv.rfind('h', 1, -1) == bs.rfind('h', 1, -1) &&
+                 bv.find('z') == -1 && bv[-1] == 'o' &&
+                 bv.subrange(-5, 100).data() == text.data() + text.size() - 5 &&
+                 bytes(bv.subrange(2, -3)) == bs.subrange(2, -3) && bs.subrange(5, 2).size() == 0);
+  str s1, s2;
+  minicode::decode<minicode::utf8>(bv, s1);
+  minicode::decode<minicode::utf8>(bs, s2);
+  bytes b1;
+  minicode::encode<minicode::utf16le>(minicode::str_view(s1).subrange(7, 9), b1);
+  bool equal2 = (s1 == s2 && b1 == bytes("\x2d\x4e\x87\x65", 4));
+  minicode::stream<minicode::utf8> st(bv.subrange(0, 5));
+  minicode::uchar uc;
+  int n = 0;
+  while (st.get(uc)) {
+    ++n;
+  }
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<(n == 5)<<endl;
+  cout<<endl;
+}
+
+// text in the repertoire of a single byte codec, from the code points of ss
+template<typename T>
+str single_byte_text(const str& ss) {
+  str r(ss.size());
+  T t;
+  for (int i = 0; i < (int)ss.size(); ++i) {
+    char c = (char)(ss[i].value() % 5 == 0 ? ss[i].value() & 0x7f : ss[i].value() & 0xff);
+    if (t(&c, 1, r[i]) < 0) {
+      r[i] = minicode::uchar('?');
+    }
+  }
+  return r;
+}
+
+template<typename T>
+void test_single_byte(const str& ss, minicode::uchar u80) {
+  // every mapped byte round trips
+  bool equal1 = true;
+  T t;
+  for (int b = 0; b < 256; ++b) {
+    char c = (char)b, d = 0;
+    minicode::uchar u;
+    equal1 = equal1 && (t(&c, 1, u) < 0 || (t(u, &d, 1) == 1 && d == c));
+  }
+  minicode::uchar u;
+  char c80 = (char)0x80;
+  char e[4];
+  equal1 = equal1 && t(&c80, 1, u) == 1 && u == u80 && t(minicode::uchar(0x4e2du), e, 4) == -1;
+  str text = single_byte_text<T>(ss);
+  bytes b1, b2;
+  str s1;
+  minicode::encode<T>(text, b1);
+  minicode::convert<T, minicode::utf8>(b1, b2);
+  minicode::decode<minicode::utf8>(b2, s1);
+  bool equal2 = (b1.size() == text.size() && s1 == text);
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<endl;
+  cout<<endl;
+}
+
+// a runtime pair against the templated one
+template<typename T1, typename T2>
+bool same_as_static(const char* n1, const char* n2, const str& ss) {
+  const minicode::codec *c1 = minicode::codec_by_name(n1);
+  const minicode::codec *c2 = minicode::codec_by_name(n2);
+  if (c1 == nullptr || c2 == nullptr) {
+    return false;
+  }
+  bytes b1, b2, b3, b4;
+  minicode::encode<T1>(ss, b1);
+  int x1 = minicode::convert<T1, T2>(b1, b2);
+  int x2 = minicode::convert(*c1, *c2, b1, b3);
+  minicode::encode(*c1, ss, b4);
+  str s1;
+  int y = minicode::decode(*c1, b1, s1);
+  // stop at the same place on bad input
+  bytes b5 = b1, b6, b7;
+  b5[(int)(b5.size() / 3)] = (char)0xff;
+  int z1 = minicode::convert<T1, T2>(b5, b6);
+  int z2 = minicode::convert(*c1, *c2, b5, b7);
+  return x1 == x2 && b2 == b3 && b4 == b1 && y == 0 && s1 == ss && z1 == z2 && b6 == b7;
+}
+
+void test_codec(const str& mixed, const str& text1252, const str& sjis) {
+  minicode::register_cjk_codecs();
+  bool equal1 = (minicode::codec_by_name("UTF8") == minicode::codec_by_name("utf-8") &&
+                 minicode::codec_by_name("Latin-1") == minicode::codec_by_name("iso-8859-1") &&
+                 minicode::codec_by_name("sjis") == minicode::codec_by_name("Shift_JIS") &&
+                 minicode::codec_by_name("utf-8")->utf8 && minicode::codec_by_name("no-such") == nullptr &&
+                 minicode::codecs().size() == 16 && minicode::simd_level() != nullptr &&
+                 minicode::codec_by_name("utf-16le")->utf == 0 && minicode::codec_by_name("utf-32be")->utf == 3 &&
+                 minicode::codec_by_name("utf-8")->utf == -1 && minicode::codec_by_name("gb18030")->utf == -1);
+#if defined(MINICODE_AVX2_KERNELS)
+  // the avx2 kernels run exactly when the cpu has avx2
+  equal1 = equal1 && (std::string(minicode::simd_level()) == "avx2") == ((minicode::cpu_features() & minicode::cpu_avx2) != 0);
+#endif
+  bool equal2 = (same_as_static<minicode::utf8, minicode::utf16le>("utf-8", "utf-16le", mixed) &&
+                 same_as_static<minicode::utf16be, minicode::utf8>("utf-16be", "utf-8", mixed) &&
+                 same_as_static<minicode::utf32le, minicode::utf16be>("utf-32le", "utf-16be", mixed) &&
+                 same_as_static<minicode::utf16le, minicode::utf32be>("utf-16le", "utf-32be", mixed) &&
+                 same_as_static<minicode::utf16be, minicode::utf16le>("utf-16be", "utf-16le", mixed) &&
+                 same_as_static<minicode::utf32be, minicode::utf32le>("utf-32be", "utf-32le", mixed) &&
+                 same_as_static<minicode::cp1252, minicode::utf16le>("cp1252", "utf-16le", text1252) &&
+                 same_as_static<minicode::utf32be, minicode::cp1252>("utf-32be", "windows-1252", text1252) &&
+                 same_as_static<minicode::utf16le, minicode::cp1252>("utf-16le", "cp1252", mixed) &&
+                 same_as_static<minicode::shift_jis, minicode::utf8>("sjis", "utf8", sjis) &&
+                 same_as_static<minicode::gb18030, minicode::utf16le>("gb18030", "utf-16le", mixed));
+  // the scalar kernels agree with the simd ones
+  const minicode::codec *c = minicode::codec_by_name("utf-8");
+  bytes b1, b2;
+  minicode::encode<minicode::utf8>(mixed, b1);
+  std::vector<minicode::uchar> s1(mixed.size()), s2(mixed.size());
+  const char *i1 = b1.data(), *i2 = b1.data();
+  minicode::uchar *o1 = s1.data(), *o2 = s2.data();
+  c->simd.decode(i1, b1.limit(), o1, s1.data() + s1.size());
+  c->scalar.decode(i2, b1.limit(), o2, s2.data() + s2.size());
+  const char *i3 = b1.data();
+  bool equal3 = (i1 == b1.limit() && i2 == i1 && s1 == s2 &&
+                 c->simd.decode_length(i3, b1.limit()) == s1.size() && i3 == b1.limit());
+  // chunked through the runtime transcoder
+  std::vector<char> out;
+  minicode::codec_transcoder tc(*minicode::codec_by_name("utf-8"), *minicode::codec_by_name("gb18030"),
+                                [&out](const char* b, size_t n) { out.insert(out.end(), b, b + n); }, 100);
+  for (int i = 0; i < (int)b1.size(); i += 7) {
+    tc.feed(b1.subrange(i, i + 7).as_view());
+  }
+  minicode::encode<minicode::gb18030>(mixed, b2);
+  equal3 = equal3 && tc.finish() == 0 && bytes(out.data(), out.size()) == b2;
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// an allocator that never has memory
+template<typename T>
+struct no_memory {
+  typedef T value_type;
+  no_memory(){}
+  template<typename U>
+  no_memory(const no_memory<U>&){}
+  T* allocate(std::size_t) { throw std::bad_alloc(); }
+  void deallocate(T*, std::size_t) {}
+  template<typename U>
+  bool operator==(const no_memory<U>&) const { return true; }
+  template<typename U>
+  bool operator!=(const no_memory<U>&) const { return false; }
+};
+
+template<typename T>
+void test_decoded_view(const str& ss, const bytes& bad) {
+  bytes b1, b2, b3;
+  minicode::encode<T>(ss, b1);
+  minicode::decoded_view<T> dv(b1);
+  std::vector<minicode::uchar> v1(dv.begin(), dv.end());
+  std::copy(dv.begin(), dv.end(), minicode::encoded_inserter<T>(b2));
+  bool equal1 = (str(v1.data(), v1.size()) == ss && b2 == b1 && (size_t)std::distance(dv.begin(), dv.end()) == ss.size() &&
+                 std::count(dv.begin(), dv.end(), minicode::uchar('a')) == std::count(ss.data(), ss.limit(), minicode::uchar('a')));
+  // the range stops at an error
+  size_t k = minicode::encoded_length<T>(minicode::str_view(ss).subrange(0, 10));
+  std::vector<char> v(b1.data(), b1.data() + b1.size());
+  v.insert(v.begin() + k, bad.data(), bad.data() + bad.size());
+  bytes b4(v.data(), v.size());
+  minicode::decoded_view<T> dv4(b4);
+  auto it = dv4.begin();
+  std::advance(it, 10);
+  bool equal2 = (std::distance(dv4.begin(), dv4.end()) == 10 && it == dv4.end() && it.base() == b4.data() + k &&
+                 minicode::decoded_view<T>().empty());
+  // an encoded_inserter stops at what it can not encode
+  minicode::encoded_inserter<minicode::latin1> ins(b3);
+  *ins++ = minicode::uchar('a');
+  *ins++ = minicode::uchar(0x4e2du);
+  *ins++ = minicode::uchar('b');
+  minicode::encoded_inserter<minicode::latin1, minicode::errors::replace> rep(b3);
+  *rep++ = minicode::uchar(0x4e2du);
+  bool equal3 = (!ins.good() && rep.good() && b3 == bytes("a?", 2));
+  // more than a block into the std containers, the bytes arrive with the last copy or flush()
+  std::string s4;
+  std::vector<char> v4;
+  std::copy(dv.begin(), dv.end(), minicode::encoded_inserter<T, minicode::errors::strict, std::string>(s4));
+  minicode::encoded_inserter<T, minicode::errors::strict, std::vector<char>> vi(v4);
+  std::vector<minicode::uchar> w;
+  for (int i = 0; i < 300; ++i) {
+    w.push_back(ss[i % ss.size()]);
+    *vi++ = w.back();
+  }
+  size_t before = v4.size();
+  vi.flush();
+  bytes b5;
+  minicode::encode<T>(minicode::str_view(w.data(), w.size()), b5);
+  equal3 = equal3 && s4 == std::string(b1.data(), b1.size()) && before > 0 && before < v4.size() &&
+           bytes(v4.data(), v4.size()) == b5;
+  // raise throws at the code point, with what comes before it written
+  bytes b6;
+  size_t at = 0;
+  try {
+    minicode::encoded_inserter<minicode::latin1, minicode::errors::raise> ri(b6);
+    *ri++ = minicode::uchar('a');
+    *ri++ = minicode::uchar('b');
+    *ri++ = minicode::uchar(0x4e2du);
+  } catch (const minicode::encode_error& e) {
+    at = e.offset();
+  }
+  equal3 = equal3 && at == 2 && b6 == bytes("ab", 2);
+  // the last copy going away with no memory to write into does not terminate
+  std::vector<char, no_memory<char>> v7;
+  {
+    minicode::encoded_inserter<T, minicode::errors::strict, std::vector<char, no_memory<char>>> ni(v7);
+    *ni++ = minicode::uchar('a');
+  }
+  equal3 = equal3 && v7.empty();
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// walking backwards gives the code points in reverse
+template<typename T>
+void test_decoded_view_back(const str& ss) {
+  bytes b1;
+  minicode::encode<T>(ss, b1);
+  minicode::decoded_view<T> dv(b1);
+  std::vector<minicode::uchar> v1(ss.data(), ss.limit()), v2;
+  std::reverse(v1.begin(), v1.end());
+  for (auto it = dv.end(); it != dv.begin();) {
+    v2.push_back(*--it);
+  }
+  auto it = std::find(dv.begin(), dv.end(), ss[ss.size() / 2]);
+  bool equal = (v1 == v2 && *std::prev(std::next(it)) == *it);
+  cout<<boolalpha<<"compare "<<equal<<endl;
+  cout<<endl;
+}
+
+// positions in the text against a walk over its code points
+void test_offsets(const str& mixed) {
+  using minicode::offset_unit;
+  str ss(mixed);
+  for (size_t i = 37; i < ss.size(); i += 211) {
+    ss[i] = minicode::uchar('\n');
+  }
+  bytes b;
+  minicode::encode<minicode::utf8>(ss, b);
+  minicode::line_index li(b);
+  size_t n8 = 0, n16 = 0, line = 0, col = 0;
+  bool equal1 = true, equal2 = true;
+  for (size_t i = 0; i <= ss.size(); ++i) {
+    if (i % 7 == 0 || i == ss.size()) {
+      equal1 = equal1 && minicode::convert_offset(b, n8, offset_unit::utf8, offset_unit::utf16) == n16 &&
+               minicode::convert_offset(b, n16, offset_unit::utf16, offset_unit::utf8) == n8 &&
+               minicode::convert_offset(b, i, offset_unit::codepoint, offset_unit::utf16) == n16 &&
+               minicode::convert_offset(b, n8, offset_unit::utf8, offset_unit::codepoint) == i;
+      minicode::text_position tp = li.position(n16, offset_unit::utf16);
+      equal2 = equal2 && li.offset(n8, offset_unit::utf8, offset_unit::codepoint) == i &&
+               li.offset(i, offset_unit::codepoint, offset_unit::utf8) == n8 && tp.line == line && tp.column == col &&
+               li.offset(tp, offset_unit::utf16, offset_unit::utf8) == n8;
+    }
+    if (i == ss.size()) {
+      break;
+    }
+    uint32_t u = ss[i].value();
+    n8 += u < 0x80 ? 1 : u < 0x800 ? 2 : u < 0x10000 ? 3 : 4;
+    n16 += u > 0xffff ? 2 : 1;
+    col = u == '\n' ? 0 : col + (u > 0xffff ? 2 : 1);
+    line += u == '\n';
+  }
+  // inside a code point or past the end
+  bool equal3 = (li.lines() == line + 1 &&
+                 minicode::convert_offset(b, b.size() + 5, offset_unit::utf8, offset_unit::codepoint) == ss.size() &&
+                 li.offset(minicode::text_position{0, 1000}, offset_unit::codepoint, offset_unit::codepoint) == 37 &&
+                 minicode::convert_offset(minicode::bytes_view("\xe4\xb8\xad", 3), 2, offset_unit::utf8, offset_unit::utf16) == 0);
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// each row of a column against a convert call of its own
+template<typename T1, typename T2, typename P>
+bool check_column(const minicode::column& in, std::size_t first, std::size_t bad) {
+  minicode::column out;
+  std::size_t n = 0;
+  std::size_t r = minicode::convert_column<T1, T2, P>(in.values, minicode::view<std::int32_t>(
+      in.offsets.data() + first, in.offsets.size() - first), out);
+  bool equal = out.rows() == in.rows() - first && out.offsets[0] == 0;
+  for (std::size_t i = 0; equal && i < out.rows(); ++i) {
+    bytes b1, b2;
+    bool e = minicode::convert<T1, T2>(in.row(first + i), b1) != 0;
+    minicode::convert<T1, T2, P>(in.row(first + i), b2);
+    equal = out.row(i) == minicode::bytes_view(b2) && out.error(i) == e;
+    n += e;
+  }
+  return equal && n == r && (bad == 0) == (r == 0);
+}
+
+// rows of 0 to 40 characters, with an error in every 13th if bad is not empty
+template<typename T1, typename T2>
+void test_column(const str& ss, const bytes& bad) {
+  minicode::column col;
+  col.offsets.push_back(0);
+  std::string v;
+  bytes b;
+  std::size_t wide = 0;
+  for (int i = 0, k = 0, n = 0; i + n <= (int)ss.size() && k < 2000; i += n, ++k, n = k * 7 % 41) {
+    if (wide == 0 && k > 100 && n > 0 && ss[i].value() >= 0x80) {
+      wide = k;
+    }
+    minicode::encode<T1>(minicode::str_view(ss).subrange(i, i + n / 2), b);
+    v.append(b.data(), b.size());
+    if (k % 13 == 5) {
+      v.append(bad.data(), bad.size());
+    }
+    minicode::encode<T1>(minicode::str_view(ss).subrange(i + n / 2, i + n), b);
+    v.append(b.data(), b.size());
+    col.offsets.push_back((std::int32_t)v.size());
+  }
+  col.values = bytes(v.data(), v.size());
+  bool equal1 = (check_column<T1, T2, minicode::errors::strict>(col, 0, bad.size()) &&
+                 check_column<T1, T2, minicode::errors::replace>(col, 0, bad.size()) &&
+                 check_column<T1, T2, minicode::errors::strict>(col, 7, bad.size()));
+  // a row boundary inside a character
+  col.offsets[wide] += 1;
+  bool equal2 = wide > 0 && check_column<T1, T2, minicode::errors::replace>(col, 0, 1);
+  col.offsets[wide] -= 1;
+  bool equal3 = true;
+  try {
+    minicode::column out;
+    minicode::convert_column<T1, T2, minicode::errors::raise>(col.values, col.offsets, out);
+    equal3 = bad.size() == 0;
+  } catch (const minicode::decode_error& e) {
+    equal3 = bad.size() > 0 && e.offset() == (std::size_t)col.values.as_view().find(bad);
+  }
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// every code point against the runs of test_gen.py, then the string-wide queries
+void test_props(const str& mixed) {
+  ifstream file("props.txt");
+  string version;
+  getline(file, version);
+  bool equal1 = true;
+  if (version == minicode::detail::props::unicode_version) {
+    uint32_t first, last;
+    int cat, width, flags;
+    uint32_t next = 0;
+    while (file >> first >> last >> cat >> width >> flags) {
+      equal1 = equal1 && first == next;
+      for (uint32_t u = first; u <= last && equal1; ++u) {
+        minicode::uchar c(u);
+        equal1 = ((int)minicode::category(c) == cat && minicode::display_width(c) == width &&
+                  minicode::isspace(c) == ((flags & 1) != 0) && minicode::isalpha(c) == ((flags & 2) != 0) &&
+                  minicode::isdecimal(c) == ((flags & 4) != 0) && minicode::isdigit(c) == ((flags & 8) != 0) &&
+                  minicode::isnumeric(c) == ((flags & 16) != 0) && minicode::isprintable(c) == ((flags & 32) != 0));
+      }
+      next = last + 1;
+    }
+    equal1 = equal1 && next == 0x110000;
+  } else {
+    cout<<"unicode "<<version<<" in python, "<<minicode::detail::props::unicode_version<<" in the tables"<<endl;
+  }
+  // the bulk widths against the sum over the characters
+  str ss(mixed);
+  for (int i = 0; i < 300 && i < (int)ss.size(); ++i) {
+    ss[i] = minicode::uchar(0x4e00u + i * 97);
+  }
+  for (int i = 300; i < 600 && i < (int)ss.size(); ++i) {
+    ss[i] = minicode::uchar(0x20u + i % 95);
+  }
+  size_t w = 0;
+  for (size_t i = 0; i < ss.size(); ++i) {
+    w += minicode::display_width(ss[i]);
+  }
+  bytes b8, b16;
+  minicode::encode<minicode::utf8>(ss, b8);
+  minicode::encode<minicode::utf16le>(ss, b16);
+  bool equal2 = (minicode::display_width(ss) == w && minicode::display_width<minicode::utf8>(b8) == w &&
+                 minicode::display_width<minicode::utf16le>(b16) == w &&
+                 minicode::display_width<minicode::utf8>(minicode::bytes_view("ab\xe4\xb8\xad\xff cd", 8)) == 4);
+  str digits, words;
+  minicode::decode<minicode::utf8>(minicode::bytes_view("\xd9\xa3" "12\xef\xbc\x95", 7), digits);
+  minicode::decode<minicode::utf8>(minicode::bytes_view("caf\xc3\xa9\xe4\xb8\xad", 8), words);
+  bool equal3 = (minicode::isdigit(digits) && minicode::isdecimal(digits) && minicode::isalnum(digits) &&
+                 minicode::isalpha(words) && !minicode::isalpha(digits) && !minicode::isalpha(str()) &&
+                 minicode::isprintable(str()) && !minicode::isspace(str()) &&
+                 minicode::isspace(str(3, minicode::uchar(0x3000u))) &&
+                 minicode::category(minicode::uchar(0x301u)) == minicode::general_category::mn &&
+                 string(minicode::category_name(minicode::category(minicode::uchar('A')))) == "Lu" &&
+                 minicode::category(minicode::uchar(0x110000u)) == minicode::general_category::cn);
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// memory handed between minicode and std containers without a copy
+void test_ownership(const str& mixed) {
+  std::vector<char> v(1000, 'x');
+  const char *p = v.data();
+  bytes b(std::move(v));
+  std::vector<char> w = b.release();
+  bytes s("abc", 3);
+  std::vector<char> ws = s.release();
+  std::vector<char> few(3, 'y');
+  const char *pf = few.data();
+  bytes bf(std::move(few));
+  bool equal1 = (b.size() == 0 && w.data() == p && w.size() == 1000 && s.size() == 0 &&
+                 std::string(ws.data(), ws.size()) == "abc" && bf.data() == pf && bf.size() == 3);
+  // encode and convert straight into std::string and std::vector<char>
+  bytes e16, e8;
+  minicode::encode<minicode::utf16le>(mixed, e16);
+  minicode::encode<minicode::utf8>(mixed, e8);
+  std::string s16, s8("head");
+  std::vector<char> v8;
+  int r1 = minicode::encode<minicode::utf16le>(mixed, s16);
+  int r2 = minicode::convert<minicode::utf16le, minicode::utf8>(s16, s8, minicode::append);
+  int r3 = minicode::convert<minicode::utf16le, minicode::utf8>(s16, v8);
+  // in place, the input is the output
+  int r4 = minicode::convert<minicode::utf16le, minicode::utf16be>(s16, s16);
+  bytes e16be;
+  minicode::encode<minicode::utf16be>(mixed, e16be);
+  bool equal2 = (r1 == 0 && r2 == 0 && r3 == 0 && r4 == 0 && minicode::bytes_view(s16) == e16be &&
+                 s8 == "head" + minicode::to_string(e8) && minicode::bytes_view(v8) == e8.as_view());
+  // u8str and stream take the buffer over
+  bytes u8(e8);
+  const char *pu = u8.data();
+  minicode::u8str us(std::move(u8));
+  minicode::stream<minicode::utf8> st;
+  std::vector<char> chunk(e8.as_view().data(), e8.limit());
+  str out;
+  st.add_bytes(std::move(chunk));
+  st.read_into(out);
+  bool equal3 = (us.as_bytes().data() == pu && us.size() == mixed.size() && out == mixed);
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// short contents stay inline, an arena shows what went to the heap
+void test_small(const str& mixed) {
+  minicode::arena ar;
+  bool equal1 = true, equal2 = true;
+  for (int n = 0; n <= 40; ++n) {
+    minicode::str_view piece = minicode::str_view(mixed).subrange(1000, 1000 + n);
+    bytes ref;
+    minicode::encode<minicode::utf8>(piece, ref);
+    minicode::arena_bytes b(ar);
+    minicode::arena_str s(ar);
+    equal1 = equal1 && minicode::encode<minicode::utf8>(piece, b) == 0 && minicode::decode<minicode::utf8>(b, s) == 0;
+    equal2 = equal2 && (ar.used() == 0) == (ref.size() <= 3 * sizeof(void*) && n <= (int)(3 * sizeof(void*) / 4));
+    // copies, moves and growing past the inline size keep the contents
+    minicode::arena_str c(s);
+    minicode::arena_str m(std::move(c));
+    c = m;
+    m.resize(n + 30);
+    m.resize(n);
+    minicode::arena_bytes bm(ar);
+    bm = std::move(b);
+    equal1 = equal1 && minicode::str_view(s) == piece && minicode::str_view(m) == piece &&
+             minicode::str_view(c) == piece && minicode::bytes_view(bm) == minicode::bytes_view(ref) &&
+             b.size() == 0 && (n == 0 || (s[-1] == piece[n - 1] && bm[-1] == ref[ref.size() - 1]));
+    ar.release();
+  }
+  str e(3, minicode::uchar('x'));
+  e.resize(7);
+  e.clear();
+  e.resize(2);
+  bool equal3 = (e.size() == 2 && e[0] == minicode::uchar(0u) && e[-1] == minicode::uchar(0u) &&
+                 bytes("0123456789abcdef0123456", 23).find('6', 10) == 22 &&
+                 sizeof(bytes) <= sizeof(std::vector<char>) + sizeof(void*) &&
+                 sizeof(str) <= sizeof(std::vector<minicode::uchar>) + sizeof(void*));
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// a batch of short pieces transcoded into one arena, twice over
+void test_arena(const str& mixed) {
+  minicode::arena ar(4096);
+  minicode::str_view sv(mixed);
+  bool equal1 = true, equal2 = true;
+  for (int round = 0; round < 2; ++round) {
+    std::vector<minicode::arena_bytes> batch;
+    for (int i = 0, n = 1; i < (int)sv.size() && i < 64 * 400; i += n, n = n % 40 + 1) {
+      minicode::str_view piece = sv.subrange(i, i + n);
+      bytes b, c;
+      str s;
+      minicode::encode<minicode::utf8>(piece, b);
+      minicode::convert<minicode::utf8, minicode::utf16le>(b, c);
+      minicode::arena_bytes ab(ar), ac(ar);
+      minicode::arena_str as(ar);
+      equal1 = equal1 && minicode::encode<minicode::utf8>(piece, ab) == 0 &&
+               minicode::convert<minicode::utf8, minicode::utf16le>(ab, ac) == 0 &&
+               minicode::decode<minicode::utf16le>(ac, as) == 0 &&
+               minicode::bytes_view(ab) == minicode::bytes_view(b) && minicode::bytes_view(ac) == minicode::bytes_view(c) && minicode::str_view(as) == piece;
+      batch.push_back(ab);
+    }
+    equal2 = equal2 && ar.used() > 0 && batch.back().get_allocator() == minicode::arena_allocator<char>(ar);
+    batch.clear();
+    ar.release();
+    equal2 = equal2 && ar.used() == 0;
+  }
+  // what sequences make out of themselves stays in their arena
+  minicode::arena_str as(mixed.as_view(), ar);
+  minicode::arena_bytes ab(ar);
+  minicode::arena_allocator<minicode::uchar> a(ar);
+  std::vector<minicode::arena_str> parts = as.split(minicode::str_view(mixed).subrange(0, 1));
+  bool equal3 = (as.subrange(5, 100).get_allocator() == a && parts[0].get_allocator() == a &&
+                 minicode::str_view(as.replace(mixed.subrange(0, 2), str())) == minicode::str_view(mixed.replace(mixed.subrange(0, 2), str())) &&
+                 minicode::encode(*minicode::codec_by_name("gb18030"), as, ab) == 0 &&
+                 minicode::decode<minicode::gb18030>(ab, as) == 0 && minicode::str_view(as) == minicode::str_view(mixed));
+#if defined(MINICODE_PMR)
+  minicode::pmr::bytes pb(&ar);
+  minicode::pmr::str ps(&ar);
+  equal3 = equal3 && minicode::encode<minicode::utf16be>(mixed, pb) == 0 &&
+           minicode::decode<minicode::utf16be>(pb, ps) == 0 && minicode::str_view(ps) == minicode::str_view(mixed);
+#endif
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// an invalid sequence between two valid halves
+template<typename T>
+void test_validate(const str& ss, const bytes& bad) {
+  size_t h = ss.size() / 2;
+  bytes b1, b2, b3;
+  minicode::encode<T>(ss, b1);
+  minicode::encode<T>(minicode::str_view(ss).subrange(0, h), b2);
+  minicode::encode<T>(minicode::str_view(ss).subrange(h, ss.size()), b3);
+  std::vector<char> v(b2.data(), b2.data() + b2.size());
+  v.insert(v.end(), bad.data(), bad.data() + bad.size());
+  v.insert(v.end(), b3.data(), b3.data() + b3.size());
+  bytes b4(v.data(), v.size());
+  str s1;
+  bool equal1 = (minicode::validate<T>(b1) && minicode::first_error<T>(b1) == b1.size() &&
+                 minicode::count_codepoints<T>(b1) == ss.size() &&
+                 minicode::validate<T>(b1.data(), 0) && minicode::count_codepoints<T>(b1.data(), 0) == 0);
+  bool equal2 = (!minicode::validate<T>(b4) && minicode::first_error<T>(b4) == b2.size() &&
+                 minicode::count_codepoints<T>(b4) == h &&
+                 minicode::validate<T>(b1.data(), b1.size() - 1) == (minicode::decode<T>(b1.subrange(0, -1), s1) == 0));
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<endl;
+  cout<<endl;
+}
+
+void test_errors(const str& mixed) {
+  using namespace minicode;
+  // a stray continuation byte, a cut sequence in the middle and one at the end
+  string bad = "a\x80" "b\xe4\xb8" "c\xf0\x9f";
+  bytes bs(bad.data(), bad.size());
+  str s1, s2, s3;
+  bytes b1, b2;
+  int r1 = decode<utf8>(bs, s1);
+  int r2 = decode<utf8, errors::replace>(bs, s2);
+  int r3 = decode<utf8, errors::ignore>(bs, s3);
+  encode<utf8>(s2, b1);
+  encode<utf8>(s3, b2);
+  bool equal1 = (r1 == 7 && s1.size() == 1 && r2 == 0 && r3 == 0 &&
+                 b1 == bytes("a\xef\xbf\xbd" "b\xef\xbf\xbd" "c\xef\xbf\xbd", 12) && b2 == bytes("abc", 3));
+  // surrogateescape round trips the bad bytes
+  str s4;
+  bytes b3;
+  int r4 = decode<utf8, errors::surrogateescape>(bs, s4);
+  int r5 = encode<utf8, errors::surrogateescape>(s4, b3);
+  bool equal2 = (r4 == 0 && r5 == 0 && s4.size() == 8 && s4[1] == uchar(0xdc80u) && b3 == bs);
+  // raise reports where
+  size_t at1 = 0, at2 = 0, at3 = 0;
+  try {
+    decode<utf8, errors::raise>(bs, s1);
+  } catch (const decode_error& e) {
+    at1 = e.offset();
+  }
+  str euro;
+  decode<utf8>(bytes("a\xc3\xa9\xe2\x82\xac" "b", 7), euro);
+  try {
+    encode<latin1, errors::raise>(euro, b1);
+  } catch (const encode_error& e) {
+    at2 = e.offset();
+  }
+  try {
+    convert<utf8, latin1, errors::raise>(bytes("ab\xe2\x82\xac", 5), b1);
+  } catch (const encode_error& e) {
+    at3 = e.offset();
+  }
+  encode<latin1, errors::replace>(euro, b1);
+  encode<latin1, errors::ignore>(euro, b2);
+  convert<utf8, latin1, errors::replace>(bytes("a\x80\xe2\x82\xac", 5), b3);
+  bool equal3 = (at1 == 1 && at2 == 2 && at3 == 2 && b1 == bytes("a\xe9?b", 4) &&
+                 b2 == bytes("a\xe9" "b", 3) && b3 == bytes("a??", 3));
+  // damaged text converts the same as decoding and encoding it, clean text as strict
+  bytes b4, b5, b6;
+  encode<utf8>(mixed, b4);
+  for (size_t i = 0; i < b4.size(); i += 97) {
+    b4[i] = (char)0xff;
+  }
+  str s5, s6;
+  convert<utf8, utf16le, errors::replace>(b4, b5);
+  decode<utf8, errors::replace>(b4, s5);
+  encode<utf16le>(s5, b6);
+  encode<utf8, errors::replace>(mixed, b4);
+  decode<utf8, errors::ignore>(b4, s6);
+  size_t n16 = 0;
+  for (size_t i = 0; i < mixed.size(); ++i) {
+    n16 += mixed[i].value() > 0xffff ? 2 : 1;
+  }
+  bool equal4 = (b5 == b6 && s6 == mixed && converted_length<utf8, utf16le, errors::replace>(b4) == 2 * n16);
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<" "<<equal4<<endl;
+  cout<<endl;
+}
+
+// naive references for the search functions
+template<typename T>
+int naive_find(const vector<T>& h, const vector<T>& n, int start, int stop, bool last) {
+  int r = -1;
+  for (int i = start; i + (int)n.size() <= stop; ++i) {
+    if (std::equal(n.begin(), n.end(), h.begin() + i)) {
+      r = i;
+      if (!last) {
+        break;
+      }
+    }
+  }
+  return r;
+}
+
+void test_search(const str& mixed) {
+  // small alphabets make periodic needles and many partial matches
+  bool equal1 = true;
+  unsigned seed = 5;
+  for (int round = 0; round < 400; ++round) {
+    int alpha = 2 + round % 3;
+    vector<char> h(50 + round * 3);
+    for (char& c : h) {
+      seed = seed * 1103515245 + 12345;
+      c = 'a' + (seed >> 16) % alpha;
+    }
+    int len = 1 + round % 9;
+    int at = (seed >> 8) % (h.size() - len);
+    vector<char> n(h.begin() + at, h.begin() + at + len);
+    if (round % 4 == 0) {
+      n.back() = 'a' + (n.back() - 'a' + 1) % alpha;
+    }
+    bytes hs(h.data(), h.size());
+    minicode::bytes_view ns(n);
+    int start = round % 7, stop = (int)h.size() - round % 5;
+    int c = 0;
+    for (int i = start; (i = naive_find(h, n, i, stop, false)) >= 0; i += len) {
+      ++c;
+    }
+    equal1 = equal1 && hs.find(ns, start, stop) == naive_find(h, n, start, stop, false) &&
+             hs.rfind(ns, start, stop) == naive_find(h, n, start, stop, true) &&
+             hs.count(ns, start, stop) == c;
+  }
+  // str: single code points and substrings, both directions
+  vector<minicode::uchar> mv(mixed.data(), mixed.data() + mixed.size());
+  bool equal2 = true;
+  for (int k = 1; k < 200; ++k) {
+    int at = k * 7919 % ((int)mixed.size() - 40);
+    int len = 1 + k % 17;
+    str sub = mixed.subrange(at, at + len);
+    vector<minicode::uchar> nv(sub.data(), sub.data() + sub.size());
+    int start = at / 2, stop = std::min((int)mixed.size(), at + len + k);
+    equal2 = equal2 && mixed.find(sub, start) == naive_find(mv, nv, start, mixed.size(), false) &&
+             mixed.rfind(sub, 0, stop) == naive_find(mv, nv, 0, stop, true) &&
+             mixed.find(sub[0], start) == naive_find(mv, vector<minicode::uchar>(1, sub[0]), start, mixed.size(), false) &&
+             mixed.rfind(sub[0], 0, stop) == naive_find(mv, vector<minicode::uchar>(1, sub[0]), 0, stop, true);
+  }
+  // python results
+  string t = "a,b,,c,";
+  bytes tb(t.data(), t.size());
+  string comma = ",", dash = "--", empty;
+  vector<bytes> parts = tb.split(comma);
+  vector<bytes> parts2 = tb.split(comma, 2);
+  bool equal3 = (parts.size() == 5 && parts[2].size() == 0 && parts[3] == bytes("c", 1) &&
+                 parts2.size() == 3 && parts2[2] == bytes(",c,", 3) &&
+                 tb.replace(comma, dash) == bytes("a--b----c--", 11) &&
+                 tb.replace(comma, empty, 2) == bytes("ab,c,", 5) &&
+                 tb.replace(empty, comma, 2) == bytes(",a,,b,,c,", 9) &&
+                 tb.count(comma) == 4 && tb.count(empty) == 8 &&
+                 tb.find(empty, 3) == 3 && tb.rfind(empty) == 7 && tb.find(dash) == -1 &&
+                 tb.startswith(bytes("a,", 2)) && tb.endswith(comma) && !tb.startswith(dash));
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+template<typename T>
+void test_bulk(const str& ss) {
+  bytes b1, b2;
+  int x1 = minicode::encode<T>(ss, b1);
+  int x2 = scalar_encode<T>(ss, b2);
+  str s1, s2;
+  int y1 = minicode::decode<T>(b1, s1);
+  int y2 = scalar_decode<T>(b1, s2);
+  bool equal1 = (x1 == x2 && b1 == b2);
+  bool equal2 = (y1 == y2 && s1 == s2 && s1 == ss);
+  // corrupt some bytes, both paths must stop at the same place
+  bool equal3 = true;
+  for (int k = 1; k < 64; ++k) {
+    bytes b3 = b1;
+    b3[(int)(k * 7919u % b3.size())] = (char)(0x80 + k);
+    str s3, s4;
+    int z1 = minicode::decode<T>(b3, s3);
+    int z2 = scalar_decode<T>(b3, s4);
+    equal3 = equal3 && z1 == z2 && s3 == s4;
+  }
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<" "<<equal3<<endl;
+  cout<<endl;
+}
+
+// ascii mixed with longer sequences goes through the utf-8 blocks,
+// with the malformed ones the functor still takes as well as those it stops at
+void test_utf8_blocks() {
+  const char *pieces[] = {"a", " ", "\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80",
+                          "\xc0\x80", "\xe0\x80\x80", "\xed\xa0\x80", "\x80", "\xff", "\xe4\xb8"};
+  bool equal1 = true, equal2 = true;
+  unsigned seed = 1;
+  for (int round = 0; round < 3000; ++round) {
+    string s;
+    int n = 4 + round % 60;
+    for (int i = 0; i < n; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      int k = (seed >> 16) % 200;
+      s += pieces[k < 80 ? 0 : k < 100 ? 1 : k < 130 ? 2 : k < 180 ? 3 : k < 190 ? 4 : 5 + k % 6];
+    }
+    bytes b(s.data(), s.size());
+    str s1, s2;
+    bytes c1, c2, c3, c4;
+    equal1 = equal1 && minicode::decode<minicode::utf8>(b, s1) == scalar_decode<minicode::utf8>(b, s2) && s1 == s2;
+    equal2 = equal2 && minicode::convert<minicode::utf8, minicode::utf16le>(b, c1) ==
+                       scalar_convert<minicode::utf8, minicode::utf16le>(b, c2) && c1 == c2 &&
+                       minicode::convert<minicode::utf8, minicode::utf32be>(b, c3) ==
+                       scalar_convert<minicode::utf8, minicode::utf32be>(b, c4) && c3 == c4;
+  }
+  cout<<boolalpha<<"compare "<<equal1<<" "<<equal2<<endl;
+  cout<<endl;
+}
+
+
 int main() {
   str unicode = read_unicode("unicode.txt");
   bytes utf8 = read_file("utf8.txt");
@@ -165,20 +1293,351 @@ int main() {
   cout<<"test encode, decode <uft32be> ..."<<endl;
   test_encode_decode<minicode::utf32be>(unicode, utf32be);
 
+  bytes gb18030 = read_file("gb18030.txt");
+  str gbk_unicode = read_unicode("gbk_unicode.txt");
+  str shift_jis_unicode = read_unicode("shift_jis_unicode.txt");
+  str euc_kr_unicode = read_unicode("euc_kr_unicode.txt");
+  bytes gbk = read_file("gbk.txt");
+  bytes shift_jis = read_file("shift_jis.txt");
+  bytes euc_kr = read_file("euc_kr.txt");
+
+  cout<<"test encode, decode <gb18030> ..."<<endl;
+  test_encode_decode<minicode::gb18030>(unicode, gb18030);
+
+  cout<<"test encode, decode <gbk> ..."<<endl;
+  test_encode_decode<minicode::gbk>(gbk_unicode, gbk);
+
+  cout<<"test encode, decode <shift_jis> ..."<<endl;
+  test_encode_decode<minicode::shift_jis>(shift_jis_unicode, shift_jis);
+
+  cout<<"test encode, decode <euc_kr> ..."<<endl;
+  test_encode_decode<minicode::euc_kr>(euc_kr_unicode, euc_kr);
+
+  cout<<"test convert <gb18030, utf8> ..."<<endl;
+  test_convert<minicode::gb18030, minicode::utf8>(gb18030, utf8);
+
+  cout<<"test convert <gb18030, utf16le> ..."<<endl;
+  test_convert<minicode::gb18030, minicode::utf16le>(gb18030, utf16le);
+
+  cout<<"test stream <gb18030> ..."<<endl;
+  test_stream<minicode::gb18030>("gb18030.txt", unicode, 5);
+
+  cout<<"test stream <shift_jis> ..."<<endl;
+  test_stream<minicode::shift_jis>("shift_jis.txt", shift_jis_unicode, 5);
+
   cout<<"test stream <uft8> ..."<<endl;
-  test_stream<minicode::utf8>("utf8.txt", unicode);
+  test_stream<minicode::utf8>("utf8.txt", unicode, 16);
+  test_stream<minicode::utf8>("utf8.txt", unicode, 5);
 
   cout<<"test stream <uft16le> ..."<<endl;
-  test_stream<minicode::utf16le>("utf16le.txt", unicode);
+  test_stream<minicode::utf16le>("utf16le.txt", unicode, 16);
+  test_stream<minicode::utf16le>("utf16le.txt", unicode, 5);
 
   cout<<"test stream <uft16be> ..."<<endl;
-  test_stream<minicode::utf16be>("utf16be.txt", unicode);
+  test_stream<minicode::utf16be>("utf16be.txt", unicode, 16);
+  test_stream<minicode::utf16be>("utf16be.txt", unicode, 5);
 
   cout<<"test stream <uft32le> ..."<<endl;
-  test_stream<minicode::utf32le>("utf32le.txt", unicode);
+  test_stream<minicode::utf32le>("utf32le.txt", unicode, 16);
+  test_stream<minicode::utf32le>("utf32le.txt", unicode, 5);
 
   cout<<"test stream <uft32be> ..."<<endl;
-  test_stream<minicode::utf32be>("utf32be.txt", unicode);
+  test_stream<minicode::utf32be>("utf32be.txt", unicode, 16);
+  test_stream<minicode::utf32be>("utf32be.txt", unicode, 5);
+
+  cout<<"test file <uft8, utf32be> ..."<<endl;
+  test_file<minicode::utf8, minicode::utf32be>("utf8.txt", "utf32be.txt", unicode);
+
+  cout<<"test file <uft16le, utf8> ..."<<endl;
+  test_file<minicode::utf16le, minicode::utf8>("utf16le.txt", "utf8.txt", unicode);
+
+  str mixed = mixed_unicode(100000, 1);
+  str latin = mixed, bmp = mixed, ascii = mixed;
+  for (int i = 0; i < (int)mixed.size(); ++i) {
+    latin[i].value() &= 0xff;
+    ascii[i].value() &= 0x7f;
+    bmp[i].value() &= 0xffff;
+    if (minicode::is_surrogate(bmp[i].value())) {
+      bmp[i].value() = 0x3000;
+    }
+  }
+
+  cout<<"test view ..."<<endl;
+  test_view();
+
+  cout<<"test bulk <uft8> ..."<<endl;
+  test_bulk<minicode::utf8>(mixed);
+
+  cout<<"test utf8 blocks ..."<<endl;
+  test_utf8_blocks();
+
+  cout<<"test length <utf8, utf16le> ..."<<endl;
+  test_length<minicode::utf8, minicode::utf16le>(mixed);
+
+  cout<<"test length <utf16be, utf8> ..."<<endl;
+  test_length<minicode::utf16be, minicode::utf8>(mixed);
+
+  cout<<"test length <utf32le, utf16be> ..."<<endl;
+  test_length<minicode::utf32le, minicode::utf16be>(mixed);
+
+  cout<<"test length <utf8, utf8> ..."<<endl;
+  test_length<minicode::utf8, minicode::utf8>(mixed);
+
+  cout<<"test length <utf8, utf32be> ..."<<endl;
+  test_length<minicode::utf8, minicode::utf32be>(mixed);
+
+  cout<<"test length <utf16le, utf16be> ..."<<endl;
+  test_length<minicode::utf16le, minicode::utf16be>(mixed);
+
+  cout<<"test length <utf16le, utf32le> ..."<<endl;
+  test_length<minicode::utf16le, minicode::utf32le>(mixed);
+
+  cout<<"test length <utf32be, utf8> ..."<<endl;
+  test_length<minicode::utf32be, minicode::utf8>(mixed);
+
+  cout<<"test length <utf32le, utf32be> ..."<<endl;
+  test_length<minicode::utf32le, minicode::utf32be>(mixed);
+
+  cout<<"test stream read <utf8> ..."<<endl;
+  test_stream_read<minicode::utf8>(mixed);
+
+  cout<<"test stream read <utf16be> ..."<<endl;
+  test_stream_read<minicode::utf16be>(mixed);
+
+  cout<<"test stream read <utf32le> ..."<<endl;
+  test_stream_read<minicode::utf32le>(mixed);
+
+  cout<<"test stream lag ..."<<endl;
+  test_stream_lag();
+
+  cout<<"test transcoder <utf8, utf16le> ..."<<endl;
+  test_transcoder<minicode::utf8, minicode::utf16le>(mixed);
+
+  cout<<"test transcoder <utf16be, utf8> ..."<<endl;
+  test_transcoder<minicode::utf16be, minicode::utf8>(mixed);
+
+  cout<<"test transcoder <utf32le, utf16be> ..."<<endl;
+  test_transcoder<minicode::utf32le, minicode::utf16be>(mixed);
+
+  cout<<"test parallel <utf8, utf16le> ..."<<endl;
+  test_parallel<minicode::utf8, minicode::utf16le>(mixed);
+
+  cout<<"test parallel <utf16be, utf8> ..."<<endl;
+  test_parallel<minicode::utf16be, minicode::utf8>(mixed);
+
+  cout<<"test parallel <utf32le, utf16be> ..."<<endl;
+  test_parallel<minicode::utf32le, minicode::utf16be>(mixed);
+
+  cout<<"test compact <utf8> ..."<<endl;
+  test_compact<minicode::utf8>(mixed, 4);
+  test_compact<minicode::utf8>(latin, 1);
+  test_compact<minicode::utf16le>(latin, 1);
+  test_compact<minicode::utf8>(bmp, 2);
+  test_compact<minicode::utf32be>(bmp, 2);
+
+  cout<<"test single byte ..."<<endl;
+  test_single_byte<minicode::latin1>(mixed, minicode::uchar(0x80u));
+  test_single_byte<minicode::iso8859_2>(mixed, minicode::uchar(0x80u));
+  test_single_byte<minicode::iso8859_15>(mixed, minicode::uchar(0x80u));
+  test_single_byte<minicode::cp1250>(mixed, minicode::uchar(0x20acu));
+  test_single_byte<minicode::cp1251>(mixed, minicode::uchar(0x402u));
+  test_single_byte<minicode::cp1252>(mixed, minicode::uchar(0x20acu));
+  str text1252 = single_byte_text<minicode::cp1252>(mixed);
+  str text1251 = single_byte_text<minicode::cp1251>(mixed);
+
+  cout<<"test bulk <cp1252> ..."<<endl;
+  test_bulk<minicode::cp1252>(text1252);
+
+  cout<<"test bulk <cp1251> ..."<<endl;
+  test_bulk<minicode::cp1251>(text1251);
+
+  cout<<"test transcode <cp1252, utf8> ..."<<endl;
+  test_transcode<minicode::cp1252, minicode::utf8>(text1252);
+
+  cout<<"test transcode <cp1251, utf16le> ..."<<endl;
+  test_transcode<minicode::cp1251, minicode::utf16le>(text1251);
+
+  cout<<"test transcode <utf8, cp1252> ..."<<endl;
+  test_transcode<minicode::utf8, minicode::cp1252>(text1252);
+
+  cout<<"test transcode <utf16be, iso8859_15> ..."<<endl;
+  test_transcode<minicode::utf16be, minicode::iso8859_15>(text1252);
+
+  cout<<"test transcode <cp1252, iso8859_15> ..."<<endl;
+  test_transcode<minicode::cp1252, minicode::iso8859_15>(text1252);
+
+  cout<<"test length <cp1252, utf8> ..."<<endl;
+  test_length<minicode::cp1252, minicode::utf8>(text1252);
+
+  cout<<"test parallel <cp1252, utf8> ..."<<endl;
+  test_parallel<minicode::cp1252, minicode::utf8>(text1252);
+
+  cout<<"test bulk <gb18030> ..."<<endl;
+  test_bulk<minicode::gb18030>(mixed);
+
+  cout<<"test transcode <gb18030, utf8> ..."<<endl;
+  test_transcode<minicode::gb18030, minicode::utf8>(mixed);
+
+  cout<<"test transcode <utf8, gb18030> ..."<<endl;
+  test_transcode<minicode::utf8, minicode::gb18030>(mixed);
+
+  cout<<"test transcode <utf16le, gbk> ..."<<endl;
+  test_transcode<minicode::utf16le, minicode::gbk>(gbk_unicode);
+
+  cout<<"test transcode <shift_jis, utf8> ..."<<endl;
+  test_transcode<minicode::shift_jis, minicode::utf8>(shift_jis_unicode);
+
+  cout<<"test transcode <euc_kr, utf16be> ..."<<endl;
+  test_transcode<minicode::euc_kr, minicode::utf16be>(euc_kr_unicode);
+
+  cout<<"test transcoder <utf8, shift_jis> ..."<<endl;
+  test_transcoder<minicode::utf8, minicode::shift_jis>(shift_jis_unicode);
+
+  cout<<"test codec ..."<<endl;
+  test_codec(mixed, text1252, shift_jis_unicode);
+
+  cout<<"test validate <utf8> ..."<<endl;
+  test_validate<minicode::utf8>(mixed, bytes("\xed\xa0\x80", 3));
+  test_validate<minicode::utf8>(ascii, bytes("\xe4\xb8", 2));
+
+  cout<<"test validate <utf16le> ..."<<endl;
+  test_validate<minicode::utf16le>(mixed, bytes("\x00\xdc", 2));
+
+  cout<<"test validate <utf16be> ..."<<endl;
+  test_validate<minicode::utf16be>(mixed, bytes("\xd8\x00\x00\x41", 4));
+
+  cout<<"test validate <utf32le> ..."<<endl;
+  test_validate<minicode::utf32le>(mixed, bytes("\x00\x00\x11\x00", 4));
+
+  cout<<"test validate <utf32be> ..."<<endl;
+  test_validate<minicode::utf32be>(mixed, bytes("\x00\x00\xd8\x00", 4));
+
+  cout<<"test validate <cp1252> ..."<<endl;
+  test_validate<minicode::cp1252>(text1252, bytes("\x81", 1));
+
+  cout<<"test validate <gb18030> ..."<<endl;
+  test_validate<minicode::gb18030>(mixed, bytes("\xff", 1));
+
+  cout<<"test decoded_view <utf8> ..."<<endl;
+  test_decoded_view<minicode::utf8>(mixed, bytes("\xff", 1));
+  test_decoded_view_back<minicode::utf8>(mixed);
+
+  cout<<"test decoded_view <utf16be> ..."<<endl;
+  test_decoded_view<minicode::utf16be>(mixed, bytes("\xdc\x00", 2));
+  test_decoded_view_back<minicode::utf16be>(mixed);
+
+  cout<<"test decoded_view <utf32le> ..."<<endl;
+  test_decoded_view<minicode::utf32le>(mixed, bytes("\x00\x00\x11\x00", 4));
+  test_decoded_view_back<minicode::utf32le>(mixed);
+
+  cout<<"test decoded_view <cp1251> ..."<<endl;
+  test_decoded_view<minicode::cp1251>(text1251, bytes("\x98", 1));
+  test_decoded_view_back<minicode::cp1251>(text1251);
+
+  cout<<"test decoded_view <gb18030> ..."<<endl;
+  test_decoded_view<minicode::gb18030>(mixed, bytes("\xff", 1));
+
+  cout<<"test offsets ..."<<endl;
+  test_offsets(mixed);
+
+  cout<<"test errors ..."<<endl;
+  test_errors(mixed);
+
+  cout<<"test arena ..."<<endl;
+  test_arena(mixed);
+
+  cout<<"test small ..."<<endl;
+  test_small(mixed);
+
+  cout<<"test ownership ..."<<endl;
+  test_ownership(mixed);
+
+  cout<<"test props ..."<<endl;
+  test_props(mixed);
+
+  cout<<"test column <utf8, utf16le> ..."<<endl;
+  test_column<minicode::utf8, minicode::utf16le>(mixed, bytes("\xff", 1));
+
+  cout<<"test column <utf16be, utf8> ..."<<endl;
+  test_column<minicode::utf16be, minicode::utf8>(mixed, bytes());
+
+  cout<<"test column <utf32le, utf16be> ..."<<endl;
+  test_column<minicode::utf32le, minicode::utf16be>(mixed, bytes("\x00\x00\x11\x00", 4));
+
+  cout<<"test column <gb18030, utf8> ..."<<endl;
+  test_column<minicode::gb18030, minicode::utf8>(mixed, bytes("\xff", 1));
+
+  cout<<"test search ..."<<endl;
+  test_search(mixed);
+
+  cout<<"test u8str ..."<<endl;
+  test_u8str(mixed);
+  test_u8str(mixed.subrange(0, 64 * 40));
+  test_u8str(latin);
+  test_u8str(ascii);
+
+  cout<<"test transcode <utf8, utf8> ..."<<endl;
+  test_transcode<minicode::utf8, minicode::utf8>(mixed);
+
+  cout<<"test transcode <utf8, utf16le> ..."<<endl;
+  test_transcode<minicode::utf8, minicode::utf16le>(mixed);
+
+  cout<<"test transcode <utf8, utf16be> ..."<<endl;
+  test_transcode<minicode::utf8, minicode::utf16be>(mixed);
+
+  cout<<"test transcode <utf8, utf32le> ..."<<endl;
+  test_transcode<minicode::utf8, minicode::utf32le>(mixed);
+
+  cout<<"test transcode <utf8, utf32be> ..."<<endl;
+  test_transcode<minicode::utf8, minicode::utf32be>(mixed);
+
+  cout<<"test transcode <utf16le, utf8> ..."<<endl;
+  test_transcode<minicode::utf16le, minicode::utf8>(mixed);
+
+  cout<<"test transcode <utf16be, utf8> ..."<<endl;
+  test_transcode<minicode::utf16be, minicode::utf8>(mixed);
+
+  cout<<"test transcode <utf16le, utf16le> ..."<<endl;
+  test_transcode<minicode::utf16le, minicode::utf16le>(mixed);
+
+  cout<<"test transcode <utf16le, utf16be> ..."<<endl;
+  test_transcode<minicode::utf16le, minicode::utf16be>(mixed);
+
+  cout<<"test transcode <utf16be, utf16le> ..."<<endl;
+  test_transcode<minicode::utf16be, minicode::utf16le>(mixed);
+
+  cout<<"test transcode <utf16le, utf32le> ..."<<endl;
+  test_transcode<minicode::utf16le, minicode::utf32le>(mixed);
+
+  cout<<"test transcode <utf16be, utf32be> ..."<<endl;
+  test_transcode<minicode::utf16be, minicode::utf32be>(mixed);
+
+  cout<<"test transcode <utf16le, utf32be> ..."<<endl;
+  test_transcode<minicode::utf16le, minicode::utf32be>(mixed);
+
+  cout<<"test transcode <utf32le, utf8> ..."<<endl;
+  test_transcode<minicode::utf32le, minicode::utf8>(mixed);
+
+  cout<<"test transcode <utf32be, utf8> ..."<<endl;
+  test_transcode<minicode::utf32be, minicode::utf8>(mixed);
+
+  cout<<"test transcode <utf32le, utf16le> ..."<<endl;
+  test_transcode<minicode::utf32le, minicode::utf16le>(mixed);
+
+  cout<<"test transcode <utf32be, utf16le> ..."<<endl;
+  test_transcode<minicode::utf32be, minicode::utf16le>(mixed);
+
+  cout<<"test transcode <utf32le, utf16be> ..."<<endl;
+  test_transcode<minicode::utf32le, minicode::utf16be>(mixed);
+
+  cout<<"test transcode <utf32le, utf32le> ..."<<endl;
+  test_transcode<minicode::utf32le, minicode::utf32le>(mixed);
+
+  cout<<"test transcode <utf32le, utf32be> ..."<<endl;
+  test_transcode<minicode::utf32le, minicode::utf32be>(mixed);
+
+  cout<<"test transcode <utf32be, utf32le> ..."<<endl;
+  test_transcode<minicode::utf32be, minicode::utf32le>(mixed);
 
   return 0;
 }
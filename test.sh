@@ -1,7 +1,10 @@
 #!/usr/bin/env bash
 
 echo "compiling the test.cpp ..."
-g++ -Wall -Wextra -std=c++11 test.cpp -o test
+g++ -Wall -Wextra -std=c++11 -pthread test.cpp -o test
+
+echo "compiling the minicode-conv.cpp ..."
+g++ -Wall -Wextra -O2 -std=c++11 -pthread minicode-conv.cpp -o minicode-conv
 
 echo ""
 echo "run test ..."
@@ -9,6 +12,12 @@ echo ""
 ./test_gen.py 10000
 ./test
 
+echo "test minicode-conv ..."
+./minicode-conv -f utf-8 -t utf-16be utf8.txt -o conv.txt && cmp conv.txt utf16be.txt && echo "true"
+./minicode-conv -f utf-32le -t utf-8 < utf32le.txt > conv.txt && cmp conv.txt utf8.txt && echo "true"
+./minicode-conv -f gb18030 -t utf-16le gb18030.txt -o conv.txt && cmp conv.txt utf16le.txt && echo "true"
+cat utf8.txt | ./minicode-conv -f utf-8 -t utf-16le /dev/stdin -o conv.txt && cmp conv.txt utf16le.txt && echo "true"
+
 echo ""
 echo "clean ..."
-rm test *.txt
+rm test minicode-conv *.txt
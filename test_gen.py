@@ -2,6 +2,8 @@
 
 import sys
 import random
+import unicodedata
+import unicode_gen
 
 def rand_unicode():
     u = 0xd800
@@ -12,6 +14,22 @@ def rand_unicode():
 def rand_text(n):
     return "".join([rand_unicode() for _ in range(n)])
 
+def repertoire(codec):
+    cs = [chr(b) for b in range(0x80)]
+    for l in range(0x80, 0x100):
+        for t in [None] + list(range(0x40, 0x100)):
+            try:
+                u = bytes([l] if t is None else [l, t]).decode(codec)
+            except UnicodeDecodeError:
+                continue
+            if len(u) == 1:
+                cs.append(u)
+    return cs
+
+def rand_codec_text(codec, n):
+    cs = repertoire(codec)
+    return "".join([random.choice(cs) for _ in range(n)])
+
 def write_file(name, bs):
     with open(name, 'wb') as f:
         f.write(bs)
@@ -22,6 +40,17 @@ def write_unicode(name, uu):
             f.write(str(ord(u)))
             f.write("\n")
 
+def write_props(name):
+    # runs of code points with the same properties: first, last, category, width and flags
+    with open(name, "w") as f:
+        f.write(unicodedata.unidata_version + "\n")
+        start, prev = 0, unicode_gen.properties(0)
+        for u in range(1, 0x110001):
+            p = unicode_gen.properties(u) if u < 0x110000 else None
+            if p != prev:
+                f.write("%d %d %d %d %d\n" % ((start, u - 1) + prev))
+                start, prev = u, p
+
 def main(script, n, *argv):
     ss = rand_text(int(n))
     write_unicode("unicode.txt", ss)
@@ -35,6 +64,12 @@ def main(script, n, *argv):
     write_file("utf32be.txt", utf32be)
     utf32le = ss.encode("utf-32le")
     write_file("utf32le.txt", utf32le)
+    write_file("gb18030.txt", ss.encode("gb18030"))
+    for codec in ["gbk", "shift_jis", "euc_kr"]:
+        cs = rand_codec_text(codec, int(n))
+        write_unicode(codec + "_unicode.txt", cs)
+        write_file(codec + ".txt", cs.encode(codec))
+    write_props("props.txt")
 
 if __name__ == '__main__':
     main(*sys.argv)
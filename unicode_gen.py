@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+
+# generate minicode_unicode_tables.h from the Python unicodedata
+
+import sys
+import unicodedata
+
+CATEGORIES = ['Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Mn', 'Mc', 'Me', 'Nd', 'Nl', 'No',
+              'Pc', 'Pd', 'Ps', 'Pe', 'Pi', 'Pf', 'Po', 'Sm', 'Sc', 'Sk', 'So',
+              'Zs', 'Zl', 'Zp', 'Cc', 'Cf', 'Cs', 'Co', 'Cn']
+
+# flags, the same as the str methods of Python
+SPACE, ALPHA, DECIMAL, DIGIT, NUMERIC, PRINTABLE = 1, 2, 4, 8, 16, 32
+
+def width(u, cat):
+    # columns on a terminal, as wcwidth has it, but 0 for the control characters
+    if cat in ('Mn', 'Me', 'Cf', 'Cc', 'Zl', 'Zp') and u != 0xad:
+        return 0
+    if 0x1160 <= u <= 0x11ff or u == 0x200b:
+        return 0
+    if unicodedata.east_asian_width(chr(u)) in 'WF':
+        return 2
+    # unassigned code points of the cjk planes are wide by default
+    if 0x20000 <= u <= 0x3fffd:
+        return 2
+    return 1
+
+def flags(c):
+    return ((SPACE if c.isspace() else 0) | (ALPHA if c.isalpha() else 0) |
+            (DECIMAL if c.isdecimal() else 0) | (DIGIT if c.isdigit() else 0) |
+            (NUMERIC if c.isnumeric() else 0) | (PRINTABLE if c.isprintable() else 0))
+
+def properties(u):
+    c = chr(u)
+    cat = unicodedata.category(c)
+    return CATEGORIES.index(cat), width(u, cat), flags(c)
+
+def record(p):
+    return p[0] | p[1] << 5 | p[2] << 7
+
+def split(values, shift):
+    # values in blocks of 1 << shift, equal blocks stored once
+    size = 1 << shift
+    index, blocks, seen = [], [], {}
+    for i in range(0, len(values), size):
+        b = tuple(values[i:i + size])
+        if b not in seen:
+            seen[b] = len(blocks)
+            blocks.append(b)
+        index.append(seen[b])
+    return index, [v for b in blocks for v in b]
+
+def ctype(values):
+    return 'std::uint8_t' if max(values) < 256 else 'std::uint16_t'
+
+def nbytes(values):
+    return len(values) * (1 if max(values) < 256 else 2)
+
+def trie(values):
+    # three stages, with the block sizes that take the least memory
+    best = None
+    for s2 in range(3, 9):
+        mid, leaf = split(values, s2)
+        for s1 in range(1, 9):
+            top, mid2 = split(mid, s1)
+            size = nbytes(top) + nbytes(mid2) + nbytes(leaf)
+            if best is None or size < best[0]:
+                best = (size, s1 + s2, s2, top, mid2, leaf)
+    return best
+
+def array(out, ctype, name, comment, values, per_line=16):
+    out.append('// %s' % comment)
+    out.append('inline const %s* %s() {' % (ctype, name))
+    out.append('  static const %s t[%d] = {' % (ctype, len(values)))
+    for i in range(0, len(values), per_line):
+        out.append('    ' + ', '.join(str(v) for v in values[i:i + per_line]) + ',')
+    out.append('  };')
+    out.append('  return t;')
+    out.append('}')
+    out.append('')
+
+def main(script, name='minicode_unicode_tables.h', *argv):
+    recs, ids = [], {}
+    values = []
+    for u in range(0x110000):
+        r = record(properties(u))
+        if r not in ids:
+            ids[r] = len(recs)
+            recs.append(r)
+        values.append(ids[r])
+    size, shift1, shift2, top, mid, leaf = trie(values)
+
+    out = ['// generated by unicode_gen.py from the Python unicodedata, do not edit',
+           '',
+           '#ifndef _MINICODE_UNICODE_TABLES_H_',
+           '#define _MINICODE_UNICODE_TABLES_H_ 1',
+           '',
+           '#include <cstdint>',
+           '',
+           'namespace minicode {',
+           'namespace detail {',
+           'namespace props {',
+           '',
+           'const char* const unicode_version = "%s";' % unicodedata.unidata_version,
+           '',
+           '// record of u is records()[leaf()[(mid()[(top()[u >> shift1] << (shift1 - shift2)) +',
+           '//   ((u >> shift2) & ((1 << (shift1 - shift2)) - 1))] << shift2) + (u & ((1 << shift2) - 1))]],',
+           '// %d bytes in all' % (size + len(recs) * 2 + 128),
+           'const int shift1 = %d;' % shift1,
+           'const int shift2 = %d;' % shift2,
+           '']
+    array(out, 'std::uint16_t', 'records',
+          'category, then width << 5, then flags << 7: space, alpha, decimal, digit, numeric, printable',
+          recs, 12)
+    array(out, 'std::uint8_t', 'ascii', 'record of each ascii code point, without the trie', values[:128])
+    array(out, ctype(top), 'top', 'mid block of each range of 1 << shift1', top)
+    array(out, ctype(mid), 'mid', 'leaf block of each range of 1 << shift2', mid)
+    array(out, ctype(leaf), 'leaf', 'record of each code point', leaf, 32)
+    out += ['} // namespace props',
+            '} // namespace detail',
+            '} // namespace minicode',
+            '',
+            '#endif // _MINICODE_UNICODE_TABLES_H_']
+    with open(name, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+if __name__ == '__main__':
+    main(*sys.argv)